@@ -65,15 +65,15 @@ int main() {
             break;
 
         auto& calc = client::calculator;    // Our grammar
-        bool r = parser(client::calculator, ' '_x).match(str);
 
-        if (r) {
+        try {
+            // Failure throws, so no separate match() beforehand
             auto p = parser(client::calculator, ' '_x)(str);
 
             std::cout << "-------------------------\n";
             std::cout << "Parsing succeeded: " << p << "\n";
             std::cout << "-------------------------\n";
-        } else {
+        } catch (std::runtime_error const &) {
             std::cout << "-------------------------\n";
             std::cout << "Parsing failed\n";
             std::cout << "-------------------------\n";
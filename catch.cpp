@@ -1,6 +1,15 @@
 #include "catch.hpp"
 #include "xf.hpp"
+#include "test/x3/real_corpus.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <list>
+#include <map>
+#include <sstream>
 
 namespace xf {
 using namespace literals;
@@ -168,4 +177,883 @@ TEST_CASE("15") {
     blah m_bah;
 }
 
+TEST_CASE("16") {
+    using wide = variant<false, char, short, int, long, float, double, std::string>;
+    wide var(6_c, "wide");
+    REQUIRE(var.index() == 6);
+    REQUIRE(var.visit([](auto i, auto const &t) {return int(i);}) == 6);
+    wide copy{var};
+    REQUIRE(copy[6_c] == "wide");
+    copy.emplace(2_c, 5);
+    REQUIRE(copy[2_c] == 5);
+    REQUIRE(var[6_c] == "wide");
+
+    variant<false, char, short, int, long, float, double> num(4_c, 2.5f);
+    REQUIRE(static_cast<double>(num) == 2.5);
+}
+
+namespace first_rules {
+XF_DECLARE(word);
+XF_DECLARE(number);
+XF_DECLARE(token);
+XF_DECLARE(group);
+XF_DECLARE(item);
+XF_DECLARE(loop);
+XF_DEFINE(word) = +alpha_x;
+XF_DEFINE(number) = uint_x;
+XF_DEFINE(token) = any(word, number, ';'_x);
+XF_DEFINE(group) = seq('('_x, *item, ')'_x);
+XF_DEFINE(item) = any(word, group);
+XF_DEFINE(loop) = any(seq(loop, 'x'_x), 'y'_x);
+}
+
+TEST_CASE("17") {
+    constexpr auto kw = "if"_x | "in"_x | "else"_x | +digit_x | ~'-'_x;
+    static_assert(first(kw).contains('i') && first(kw).nullable(), "");
+    static_assert(!first("else"_x).contains('i'), "");
+
+    std::string s = "else";
+    REQUIRE(parser(kw)(s).index() == 2);
+    s = "in";
+    REQUIRE(parser(kw)(s).index() == 1);
+    s = "42";
+    REQUIRE(parser(kw)(s).index() == 3);
+    s = "-";
+    REQUIRE(parser(kw)(s).index() == 4);
+    s = "";
+    REQUIRE(parser(kw)(s).index() == 4);
+
+    // With no branch able to start on 'x', only the nullable one is tried
+    std::string x = "x";
+    auto w2 = make_window(x);
+    auto c = check(check_c, kw, w2);
+    REQUIRE(c);
+    REQUIRE(c->index() == 4);
+    REQUIRE(w2.begin() == x.begin());
+
+    // Other comparisons fall back to trying each branch in turn
+    std::string u = "ELSE";
+    auto w3 = make_window(u, caseless_compare());
+    auto c3 = check(check_c, kw, w3);
+    REQUIRE(c3->index() == 2);
+
+    // Numbers start with the digits of their radix
+    constexpr auto hex = uint_parser<unsigned, 16>();
+    static_assert(first(hex).contains('f') && first(hex).contains('F') && !first(hex).contains('g'), "");
+    static_assert(!first(uint_parser<unsigned, 8>()).contains('8'), "");
+    static_assert(first(int_parser<int, 16>()).contains('a'), "");
+
+    // Rules only have first sets at run time, and stop where they recurse
+    using namespace first_rules;
+    REQUIRE(first(item).nullable());
+    auto const f = first(rule_first_c, item);
+    REQUIRE((f.contains('(') && f.contains('q') && !f.contains(')') && !f.nullable()));
+    REQUIRE((first(rule_first_c, group).contains('(') && !first(rule_first_c, group).contains('q')));
+    REQUIRE(first(rule_first_c, loop).contains('q')); // left recursion gives up
+
+    // So an alternative of rules only tries the ones which can start with the next character
+    auto const p = parser(*token, ' '_x);
+    std::string const tokens = "ab 12 ; cd 3";
+    profiler prof;
+    REQUIRE(p.profile(tokens, prof).size() == 5);
+    std::map<std::string, profiler::entry> e;
+    for (auto const &x : prof.flat()) e[x.name] = x;
+    REQUIRE(e["word"].calls == 2);
+    REQUIRE(e["number"].calls == 2);
+    REQUIRE(e["token"].calls == 6);
+
+    // Rules hold no data, so an alternative of them carries no table
+    static_assert(sizeof(any(word, number)) < 8, "");
+}
+
+TEST_CASE("18") {
+    arena memory(64);
+    REQUIRE(memory.blocks() == 0);
+    memory.allocate(1, 1);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(memory.allocate(8, 8)) % 8 == 0);
+    memory.allocate(1000, 16);
+    REQUIRE(memory.allocations() == 3);
+    REQUIRE(memory.blocks() == 2);
+
+    constexpr auto x = 'a'_x | 'b'_x;
+    std::string s = "b";
+    arena scoped;
+    auto w = make_window(s);
+    auto data = [&] {arena_scope scope(&scoped); return check(check_c, x, w);}();
+    REQUIRE(arena::current() == nullptr);
+    REQUIRE(scoped.allocations() == 1);
+    auto copy = data;
+    REQUIRE(scoped.allocations() == 1);
+    REQUIRE(parse(parse_c, x, std::move(copy))[1_c] == 'b');
+    REQUIRE(parse(parse_c, x, std::move(data))[1_c] == 'b');
+
+    std::string t = "abba";
+    REQUIRE(parser(*x)(t).size() == 4);
+}
+
+TEST_CASE("19") {
+    std::string s = "12,345,6789,";
+    auto list = *seq(size_x, ',');
+    auto two = parser(list)(s);
+    auto one = parser(list).fused(s);
+    static_assert(std::is_same<decltype(one), decltype(two)>::value, "");
+    REQUIRE(one.size() == 3);
+    REQUIRE(one[2][0_c] == 6789);
+
+    auto sum = +(seq(size_x, ',') % [](auto n, char) {return n;});
+    auto total = parser(sum).fused(s);
+    REQUIRE(total.size() == 3);
+    REQUIRE(total[0] + total[1] + total[2] == 12 + 345 + 6789);
+
+    // Alternatives keep two phases underneath
+    std::string u = "in1 else2";
+    auto kw = +seq("if"_x | "in"_x | "else"_x, size_x);
+    auto p = parser(kw, ' '_x).fused(u);
+    REQUIRE(p.size() == 2);
+    REQUIRE(p[1][0_c].index() == 2);
+    REQUIRE(p[1][1_c] == 2);
+
+    REQUIRE_THROWS(parser(+'b'_x).fused(s));
+    REQUIRE(!parser(~'b'_x).fused(s));
+
+    // A failed sequence leaves the window where it was
+    auto w = make_window(s);
+    REQUIRE(!fused(seq(size_x, ';'_x), w));
+    REQUIRE(w.begin() == s.begin());
+
+    // Attributes of a fused parse are copied and grown on the heap, not in the parse's arena
+    std::string tf;
+    for (int i = 0; i != 300; ++i) tf += i % 3 ? "true " : "false ";
+    auto r = parser(*any("true"_x, "false"_x), ' '_x).fused(tf);
+    static_assert(std::is_nothrow_move_constructible<std::decay_t<decltype(r[0])>>::value, "");
+    auto copy = r;
+    REQUIRE(copy.size() == 300);
+    REQUIRE(copy[0].index() == 1);
+    REQUIRE(copy[299].index() == 0);
+    REQUIRE(copy[298][0_c] == r[298][0_c]);
+
+    // A sequence which can fail after its first element is checked before anything is built,
+    // so no action runs for the element that the last attempt gave up on
+    int runs = 0;
+    auto counted = size_x % [&](std::size_t n) {++runs; return n;};
+    std::string const numbers = "1,2,3";
+    REQUIRE(parser(*seq(counted, ','_x)).fused(numbers).size() == 2);
+    REQUIRE(runs == 2);
+    using numbers_window = decltype(make_window(numbers));
+    static_assert(can_fail<decltype(seq(counted, ','_x)), numbers_window>, "");
+    static_assert(!can_fail<decltype(*seq(counted, ','_x)), numbers_window>, "");
+
+    // Once nothing after the first element can fail, the sequence is fused
+    runs = 0;
+    auto const r2 = parser(seq(counted, *seq(','_x, counted))).fused(numbers);
+    REQUIRE(r2[1_c].size() == 2);
+    REQUIRE(runs == 3);
+
+    // Restrictions have no fused mode of their own and are checked then parsed
+    std::string csv = "ab,c";
+    REQUIRE(parser(*(print_x - ','_x)).fused(csv) == "ab");
+    REQUIRE(parser(*(print_x - ','_x))(csv) == "ab");
+}
+
+template <class Fast, class Slow, class V>
+void same_skips(Fast const &fast, Slow const &slow, V const &v) {
+    auto w1 = with_mask(make_window(v), fast);
+    auto w2 = with_mask(make_window(v), slow);
+    while (true) {
+        REQUIRE(w1.begin() - v.begin() == w2.begin() - v.begin());
+        if (!w1) break;
+        ++w1; ++w2;
+    }
+}
+
+// Same classes as space_x, blank_x and ' '_x without their bulk skipping
+struct slow_space {bool operator()(char c) const {return std::isspace(static_cast<unsigned char>(c));}};
+struct slow_blank {bool operator()(char c) const {return c == ' ' || c == '\t';}};
+struct slow_char {bool operator()(char c) const {return c == ' ';}};
+
+TEST_CASE("20") {
+    char const chars[] = " \t\n\v\f\rx\xA0";
+    for (int n : {0, 1, 15, 16, 17, 31, 32, 33, 100, 1000}) {
+        std::string s;
+        for (int i = 0; i != n; ++i) s += chars[rand() % 2 ? 0 : rand() % 8];
+        std::vector<char> v(s.begin(), s.end());
+        same_skips(space_x, char_predicate<slow_space>(), s);
+        same_skips(space_x, char_predicate<slow_space>(), v);
+        same_skips(blank_x, char_predicate<slow_blank>(), s);
+        same_skips(' '_x, char_predicate<slow_char>(), s);
+    }
+}
+
+
+template <class P>
+boost::optional<decltype(parser(std::declval<P>())(std::string()))> number(P const &p, std::string const &s) {
+    auto w = make_window(s);
+    auto data = check(check_c, p, w);
+    if (!valid(p, data) || w) return {};
+    return parse(parse_c, p, std::move(data));
+}
+
+TEST_CASE("21") {
+    REQUIRE(*number(uint8_x, "255") == 255);
+    REQUIRE(!number(uint8_x, "256"));
+    REQUIRE(*number(uint16_x, "00065535") == 65535);
+    REQUIRE(!number(uint16_x, "65536"));
+    REQUIRE(*number(uint32_x, "4294967295") == 4294967295u);
+    REQUIRE(!number(uint32_x, "4294967296"));
+    REQUIRE(*number(uint64_x, "18446744073709551615") == 18446744073709551615ull);
+    REQUIRE(!number(uint64_x, "18446744073709551616"));
+    REQUIRE(!number(uint64_x, "99999999999999999999"));
+    REQUIRE(*number(uint64_x, "000000000000000000000000000012345678901234") == 12345678901234ull);
+    REQUIRE(*number(uint64_x, "1234567812345678") == 1234567812345678ull);
+    REQUIRE(!number(uint64_x, ""));
+
+    REQUIRE(*number(uint_parser<std::uint8_t, 2>(), "11111111") == 255);
+    REQUIRE(!number(uint_parser<std::uint8_t, 2>(), "100000000"));
+    REQUIRE(!number(uint_parser<std::uint8_t, 2>(), "12"));
+    REQUIRE(*number(uint_parser<std::uint16_t, 8>(), "177777") == 65535);
+    REQUIRE(!number(uint_parser<std::uint16_t, 8>(), "200000"));
+    REQUIRE(*number(uint_parser<std::uint32_t, 16>(), "DeadBeef") == 0xDEADBEEF);
+    REQUIRE(*number(uint_parser<std::uint64_t, 16>(), "ffffffffffffffff") == ~std::uint64_t(0));
+    REQUIRE(!number(uint_parser<std::uint64_t, 16>(), "10000000000000000"));
+    REQUIRE(!number(uint_parser<std::uint32_t, 16>(), "fg"));
+    static_assert(first(uint_parser<unsigned, 16>()).contains('F') && !first(uint_x).contains('F'), "");
+
+    REQUIRE(*number(int8_x, "-128") == -128);
+    REQUIRE(*number(int8_x, "+127") == 127);
+    REQUIRE(!number(int8_x, "128"));
+    REQUIRE(!number(int8_x, "-129"));
+    REQUIRE(*number(int64_x, "-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+    REQUIRE(!number(int64_x, "9223372036854775808"));
+    REQUIRE(*number(int_x, "-0") == 0);
+
+    // A failed number consumes nothing, not even its sign
+    std::string s = "-x";
+    auto w = make_window(s);
+    REQUIRE(!valid(int_x, check(check_c, int_x, w)));
+    REQUIRE(w.begin() == s.begin());
+}
+
+TEST_CASE("22") {
+    std::string s = "key  = 42";
+    auto kv = seq(view(+alpha_x), '='_x, size_x);
+    auto r = parser(kv, ' '_x)(s);
+    static_assert(std::is_same<std::decay_t<decltype(r[0_c])>, boost::string_view>::value, "");
+    REQUIRE(r[0_c] == "key");
+    REQUIRE(r[0_c].data() == s.data());
+    REQUIRE(r[2_c] == 42);
+    REQUIRE(parser(kv, ' '_x).fused(s)[0_c] == "key");
+
+    // The view doesn't skip inside its subject
+    REQUIRE(!parser(view(seq('a'_x, 'b'_x)), ' '_x).match(std::string("a b")));
+    REQUIRE(parser(view("ab"_x | seq(*'a'_x, 'c'_x)))(std::string("aaac")) == "aaac");
+    REQUIRE(parser(view(*'a'_x))(std::string("")).empty());
+
+    // Non-contiguous input is viewed as an iterator range
+    std::list<char> l(s.begin(), s.end());
+    auto w = make_window(l);
+    auto v = check(check_c, view(+alpha_x), w);
+    auto range = parse(parse_c, view(+alpha_x), v);
+    REQUIRE(std::string(range.begin(), range.end()) == "key");
+
+    auto o = parser(seq(omit(+alpha_x), view(+digit_x)))(std::string("abc123"));
+    static_assert(std::is_same<std::decay_t<decltype(o[0_c])>, std::decay_t<decltype(hana::nothing)>>::value, "");
+    REQUIRE(o[1_c] == "123");
+    REQUIRE(!parser(omit(+alpha_x)).match(std::string("123")));
+
+    // Fused omits give attributes that containers can hold
+    std::string abc = "a;b;c;";
+    REQUIRE(parser(*seq(alpha_x, omit(';'_x))).fused(abc).size() == 3);
+    REQUIRE(parser(*omit(alpha_x)).fused(abc).size() == 1);
+}
+
+TEST_CASE("23") {
+    std::string s;
+    for (int i = 0; i != 1000; ++i) s += std::to_string(i * 7919 % 100000) + ",";
+
+    std::istringstream is(s);
+    stream_input in(is, 16, 4);
+    auto list = *seq(size_x, ','_x, commit);
+    auto r = parser(list)(in);
+    REQUIRE(r == parser(list)(s));
+    REQUIRE(r.size() == 1000);
+    REQUIRE(r[999][0_c] == 999 * 7919 % 100000);
+    REQUIRE(in.chunks() <= 1);
+
+    // Matches the string exactly without commit points when the lookback is large enough
+    std::istringstream is2(s);
+    stream_input in2(is2, 64, 1000);
+    REQUIRE(parser(*seq(size_x, ','_x))(in2) == parser(*seq(size_x, ','_x))(s));
+
+    // Backtracking past what is kept
+    std::istringstream is3(std::string(100, 'a') + "b");
+    stream_input in3(is3, 8, 2);
+    REQUIRE_THROWS_AS(parser(seq(*'a'_x, 'c'_x) | "aa"_x).match(in3), lookback_error);
+
+    // Parsing carries on from the last commit point
+    std::istringstream is4("12;34;");
+    stream_input in4(is4, 2, 2);
+    auto one = seq(size_x, ';'_x, commit);
+    REQUIRE(parser(one)(in4)[0_c] == 12);
+    REQUIRE(parser(one)(in4)[0_c] == 34);
+    REQUIRE(!parser(one).match(in4));
+
+    // Strings and repeats read their input again while parsing, so they are parsed before it is released
+    std::string words;
+    for (int i = 0; i != 200; ++i) words += "abcdefgh,";
+    auto const alpha_list = parser(*seq(+alpha_x, ','_x, commit));
+    std::istringstream is5(words);
+    stream_input in5(is5, 16, 4);
+    auto const r5 = alpha_list(in5);
+    REQUIRE(r5 == alpha_list(words));
+    REQUIRE(r5.size() == 200);
+    REQUIRE(r5[199][0_c] == "abcdefgh");
+    REQUIRE(in5.chunks() <= 1);
+
+    std::istringstream is6(words);
+    stream_input in6(is6, 16, 4);
+    REQUIRE(parser(*seq("abcdefgh"_x, ','_x, commit))(in6).size() == 200);
+
+    std::istringstream is7(words);
+    stream_input in7(is7, 16, 4);
+    REQUIRE(parser(seq(+alpha_x, commit) / ','_x)(in7).size() == 200);
+
+    // each keeps nothing per element, so checking takes the same memory however long the input is
+    std::size_t seen = 0;
+    auto const counted = *seq(+alpha_x, ','_x, commit) % each([&](auto const &t) {seen += t[0_c].size();});
+    auto held = [&](int n) {
+        std::string text;
+        for (int i = 0; i != n; ++i) text += "abcdefgh,";
+        std::istringstream is(text);
+        stream_input in(is, 16, 4);
+        arena memory;
+        arena_scope scope(&memory);
+        auto w = make_window(in);
+        auto data = check(check_c, counted, w);
+        REQUIRE(valid(counted, data));
+        parse(parse_c, counted, std::move(data));
+        REQUIRE(in.chunks() <= 1);
+        return memory.allocations();
+    };
+    REQUIRE(held(200) == held(5000));
+    REQUIRE(seen == 8 * 5200);
+
+    std::istringstream is8(words);
+    stream_input in8(is8, 16, 4);
+    seen = 0;
+    parser(counted)(in8);
+    REQUIRE(seen == 8 * 200);
+}
+
+template <class P>
+auto shared_prefix(P const &p) {return (seq(p, 'a'_x) | seq(p, 'b'_x)) % memoize;}
+
+TEST_CASE("24") {
+    auto g = shared_prefix(shared_prefix(shared_prefix(shared_prefix('x'_x % memoize))));
+    std::string s = "xbbbb";
+    auto r = parser(g)(s);
+    REQUIRE(r.index() == 1);
+    REQUIRE(r[1_c][0_c].index() == 1);
+    REQUIRE(parser(g).fused(s).index() == 1);
+    REQUIRE(!parser(g).match(std::string("xbbbc")));
+
+    // Each prefix is checked once rather than once per enclosing branch
+    memo_table memo;
+    {
+        memo_scope scope(&memo);
+        auto w = make_window(s);
+        REQUIRE(valid(g, check(check_c, g, w)));
+        REQUIRE(w.begin() == s.end());
+    }
+    REQUIRE(memo.misses() == 5);
+    REQUIRE(memo.hits() == 4);
+    REQUIRE(memo.size() == 5);
+
+    // Bounded
+    memo_table small(2);
+    {
+        memo_scope scope(&small);
+        auto w = make_window(s);
+        REQUIRE(valid(g, check(check_c, g, w)));
+    }
+    REQUIRE(small.size() <= 2);
+
+    // Iterators without an order are not memoized
+    std::list<char> l(s.begin(), s.end());
+    REQUIRE(parser(g).match(l));
+}
+
+TEST_CASE("26") {
+    // Repeats of chars and numbers keep a span rather than a vector of check data
+    std::string s = "12 345 6789 x";
+    auto w = make_window(s, hana::equal);
+    auto ws = with_mask(w, ' '_x);
+    auto data = check(check_c, *uint_x, ws);
+    static_assert(std::is_same<decltype(data), repeat_span<decltype(ws)>>::value, "");
+    REQUIRE(data.size() == 3);
+    REQUIRE(parse(parse_c, *uint_x, data) == std::vector<unsigned>({12, 345, 6789}));
+    REQUIRE(*ws == 'x');
+
+    REQUIRE(parser(+alpha_x)(std::string("abc1")) == "abc");
+    REQUIRE(!parser(+alpha_x).match(std::string("1")));
+    REQUIRE(parser(*"ab"_x)(std::string("ababa")).size() == 2);
+    REQUIRE(parser(seq(*digit_x, *alpha_x), ' '_x)(std::string("1 2 a b"))[1_c].size() == 2);
+
+    // Anything else still keeps its check data
+    auto w2 = make_window(s);
+    static_assert(!std::is_same<decltype(check(check_c, *seq(uint_x, ' '_x), w2)), repeat_span<decltype(w2)>>::value, "");
+}
+
+TEST_CASE("27") {
+    // Each element goes straight to the sink and nothing is collected
+    std::vector<unsigned> got;
+    auto sink = [&](unsigned u) {got.push_back(u);};
+    parser(*uint_x % each(sink), ' '_x)(std::string("1 2 3"));
+    REQUIRE(got == std::vector<unsigned>({1, 2, 3}));
+    static_assert(std::is_same<decltype(parser(*uint_x % each(sink))(std::string())), std::decay_t<decltype(hana::nothing)>>::value, "");
+
+    unsigned sum = 0;
+    auto add = each([&](unsigned u) {sum += u;});
+    parser(uint_x / ','_x % add)(std::string("4,5,6"));
+    REQUIRE(sum == 15);
+
+    // A plus needs one element
+    got.clear();
+    REQUIRE_THROWS(parser(+uint_x % each(sink))(std::string("")));
+
+    // Nothing is handed over from a parse that fails later on
+    REQUIRE_THROWS(parser(seq(*uint_x % each(sink), 'z'_x), ' '_x)(std::string("7 8 9 y")));
+    REQUIRE(got.empty());
+
+    // ...or from a branch that is abandoned
+    auto const g = seq(uint_x / ','_x % each(sink), ';'_x) | seq(uint_x / ','_x, '.'_x);
+    REQUIRE(parser(g)(std::string("1,2,3.")).index() == 1);
+    REQUIRE(got.empty());
+    REQUIRE(parser(g)(std::string("1,2,3;")).index() == 0);
+    REQUIRE(got == std::vector<unsigned>({1, 2, 3}));
+
+    // Separators that are not followed by an element are left alone
+    got.clear();
+    REQUIRE(parser(seq(uint_x / ','_x % each(sink), ','_x))(std::string("1,2,"))[1_c] == ',');
+    REQUIRE(got == std::vector<unsigned>({1, 2}));
+    REQUIRE(parser(uint_x / ','_x).fused(std::string("1,2,")) == std::vector<unsigned>({1, 2}));
+}
+
+TEST_CASE("28") {
+    // Compile time sets with ranges
+    constexpr auto hex = char_set<char_range<'0', '9'>, char_range<'a', 'f'>, hana::char_<'_'>>();
+    static_assert(first(hex).contains('c') && !first(hex).contains('g'), "");
+    REQUIRE(parser(+hex)(std::string("09af_g")) == "09af_");
+    REQUIRE(!parser(hex).match(std::string("")));
+    REQUIRE(parser(+eol)(std::wstring(L"\r\n")) == L"\r\n");
+
+    // Run time sets
+    constexpr auto ident = chars("a-zA-Z0-9_");
+    static_assert(ident.contains('q') && ident.contains('_') && !ident.contains('-'), "");
+    REQUIRE(chars("-a-c+").contains('-'));
+    REQUIRE(chars("-a-c+").contains('b'));
+    REQUIRE(!chars("-a-c+").contains('d'));
+    REQUIRE(parser(view(alpha_x, *ident))(std::string("name_01 x")) == "name_01");
+
+    auto greek = chars(U"a-c\u03b1-\u03c9\u0400-\u04ff\u03c0-\u0402");
+    REQUIRE(greek.contains(U'b'));
+    REQUIRE(greek.contains(U'\u03bb'));
+    REQUIRE(greek.contains(U'\u0401'));
+    REQUIRE(!greek.contains(U'\u03a9'));
+    REQUIRE(!greek.contains(U'd'));
+    REQUIRE(parser(+greek)(std::u32string(U"a\u03bbc!")) == U"a\u03bbc");
+
+    // Long runs go through the bulk path, across every block size and offset
+    std::string s;
+    for (int i = 0; i != 100; ++i) s += char('a' + i % 26);
+    for (std::size_t n = 0; n != 70; ++n) {
+        auto const t = s.substr(0, n) + "-rest";
+        auto w = make_window(t);
+        auto data = check(check_c, *ident, w);
+        REQUIRE(data.size() == n);
+        REQUIRE(*w == '-');
+        REQUIRE(parse(parse_c, *ident, data) == s.substr(0, n));
+        auto w2 = make_window(t);
+        REQUIRE(check(check_c, *hex, w2).size() == std::min<std::size_t>(n, 6));
+    }
+    // Bytes above 0x7F and masks between elements
+    REQUIRE(parser(*chars("\x80-\xff"))(std::string("\xe9\xff\x80" "a")).size() == 3);
+    REQUIRE(parser(*ident, ' '_x)(std::string("ab cd")) == "abcd");
+}
+
+TEST_CASE("29") {
+    auto real = [](auto p, std::string const &s) {return parser(p)(s);};
+    REQUIRE(real(double_x, "1.5") == 1.5);
+    REQUIRE(real(double_x, "-0.25e2") == -25.0);
+    REQUIRE(real(double_x, ".5") == 0.5);
+    REQUIRE(real(double_x, "5.") == 5.0);
+    REQUIRE(real(double_x, "1e400") == std::numeric_limits<double>::infinity());
+    REQUIRE(real(double_x, "-Infinity") == -std::numeric_limits<double>::infinity());
+    std::string const nan = "NaN";
+    auto nan_window = make_window(nan);
+    REQUIRE(check(check_c, double_x, nan_window)->kind == decimal_number<std::string::const_iterator>::nan); // -Ofast folds isnan
+    REQUIRE(real(double_x, "-0") == 0.0);
+    REQUIRE(real(double_x, "1e-400") == 0.0);
+    REQUIRE(real(float_x, "3.4028236e38") == std::numeric_limits<float>::infinity());
+    REQUIRE(real(float_x, "0.1") == 0.1f);
+
+    // Correctly rounded, including halfway cases and more than 19 digits
+    REQUIRE(real(double_x, "9007199254740993") == 9007199254740992.0);
+    REQUIRE(real(double_x, "9007199254740995") == 9007199254740996.0);
+    REQUIRE(real(double_x, "2.2250738585072011e-308") == 2.2250738585072011e-308);
+    REQUIRE(real(double_x, "4.9406564584124654e-324") == std::numeric_limits<double>::denorm_min());
+    REQUIRE(real(double_x, "2.4703282292062327e-324") == 0.0);
+    REQUIRE(real(double_x, "2.4703282292062328e-324") == std::numeric_limits<double>::denorm_min());
+    REQUIRE(real(double_x, "1.00000000000000011102230246251565404236316680908203125") == 1.0);
+    REQUIRE(real(double_x, "1.00000000000000011102230246251565404236316680908203126") == std::nextafter(1.0, 2.0));
+    REQUIRE(real(double_x, "0.000000000000000000000000000000000000000000001e45") == 1.0);
+    REQUIRE(real(double_x, "123456789012345678901234567890e-10") == 12345678901234567890.123456789);
+
+    // The corpus x3's exact_double_ and exact_float_ are tested against as well
+    for (std::size_t i = 0; i != spirit_test::real_corpus_size; ++i) {
+        auto const &c = spirit_test::real_corpus[i];
+        double const d = real(double_x, c.text);
+        float const f = real(float_x, c.text);
+        std::uint64_t db;
+        std::uint32_t fb;
+        std::memcpy(&db, &d, sizeof(d));
+        std::memcpy(&fb, &f, sizeof(f));
+        REQUIRE(db == c.double_bits);
+        REQUIRE(fb == c.float_bits);
+    }
+
+    // Against strtod on a spread of values and precisions
+    char buf[64];
+    for (int i = 0; i != 1000; ++i) {
+        double const d = std::ldexp(1.0 + i / 997.0, i % 600 - 300) * (i % 2 ? -1 : 1);
+        std::snprintf(buf, sizeof(buf), "%.*g", i % 19 + 1, d);
+        REQUIRE(real(double_x, buf) == std::strtod(buf, nullptr));
+        REQUIRE(real(float_x, buf) == std::strtof(buf, nullptr));
+    }
+
+    // An exponent marker without digits, or a lone point, is not part of the number
+    REQUIRE(parser(seq(double_x, 'e'_x))(std::string("7e"))[0_c] == 7.0);
+    REQUIRE(!parser(double_x).match(std::string(".")));
+    REQUIRE(parser(*double_x, ','_x)(std::string("1,2.5,3e1")) == std::vector<double>({1, 2.5, 30}));
+}
+
+TEST_CASE("30") {
+    static constexpr auto kw = keywords("do", "double", "if", "in", "int", "else", "elif", "d", "in");
+    static_assert(first(kw).contains('d') && !first(kw).contains('x'), "");
+
+    // Longest match whatever the order
+    REQUIRE(parser(kw)(std::string("double")) == 1);
+    REQUIRE(parser(kw)(std::string("do")) == 0);
+    REQUIRE(parser(kw)(std::string("dou")) == 0);
+    REQUIRE(parser(kw)(std::string("d")) == 7);
+    REQUIRE(parser(kw)(std::string("int")) == 4);
+    REQUIRE(parser(kw)(std::string("in")) == 3);
+    REQUIRE(!parser(kw).match(std::string("x")));
+    REQUIRE(!parser(kw).match(std::string("")));
+    REQUIRE(parser(*kw, ' '_x)(std::string("if elif else int")) == std::vector<std::size_t>({2, 6, 5, 4}));
+
+    // Other iterators and wide chars
+    REQUIRE(parser(kw)(std::list<char>({'e', 'l', 's', 'e'})) == 5);
+    REQUIRE(parser(kw)(std::u32string(U"elif")) == 6);
+    REQUIRE(!parser(kw).match(std::u32string(U"\u0169f")));
+
+    enum class token {do_, double_, if_, in, int_, else_, elif, d, in2};
+    auto const tokens = kw.map(token::do_, token::double_, token::if_, token::in, token::int_, token::else_, token::elif, token::d, token::in2);
+    REQUIRE(parser(seq(tokens, '('_x))(std::string("elif("))[0_c] == token::elif);
+
+    // Many keywords sharing first chars and lengths
+    static constexpr auto many = keywords("aa", "ab", "ac", "ad", "ae", "af", "ag", "ah", "ba", "bb", "bc", "bd", "be", "bf",
+        "aaa", "aab", "aac", "aba", "abb", "abc", "aaaa", "aaab", "abab", "abba", "a", "b");
+    for (std::size_t i = 0; i != many.size(); ++i) REQUIRE(parser(many)(std::string(many[i])) == i);
+    REQUIRE(parser(many)(std::string("aaaz")) == 14);
+    REQUIRE(parser(many)(std::string("bz")) == 25);
+}
+
+TEST_CASE("31") {
+    auto const record = seq(uint_x, ','_x, uint_x);
+    auto const lines = record / '\n'_x;
+    std::string s;
+    for (unsigned i = 0; i != 2000; ++i) s += std::to_string(i) + "," + std::to_string(i * i) + "\n";
+    s.pop_back();
+    auto const expected = parser(lines)(s);
+    for (std::size_t n : {1, 2, 3, 7, 16}) REQUIRE(parser(lines).parallel(s, n) == expected);
+    REQUIRE(parser(lines).parallel(std::vector<char>(s.begin(), s.end()), 4) == expected);
+
+    // The first bad position is the same however the input is cut
+    auto bad = s;
+    bad[bad.size() / 2 + 3] = 'x';
+    bad[bad.size() * 3 / 4] = 'x';
+    std::size_t first = 0;
+    try {parser(lines).parallel(bad, 1);} catch (parse_error const &e) {first = e.position;}
+    REQUIRE(first != 0);
+    REQUIRE(first <= bad.size() / 2 + 3);
+    for (std::size_t n : {2, 5, 8}) {
+        try {parser(lines).parallel(bad, n); REQUIRE(false);} catch (parse_error const &e) {REQUIRE(e.position == first);}
+    }
+    REQUIRE_THROWS_AS(parser(lines).parallel(s + "\n", 4), parse_error);
+    REQUIRE_THROWS_AS(parser(lines).parallel(std::string("x"), 4), parse_error);
+
+    // Elements which may span the separator are carried over the chunk boundaries they break
+    auto const quoted = seq('"'_x, *(char_x - '"'_x), '"'_x) / '\n'_x;
+    std::string q;
+    for (unsigned i = 0; i != 300; ++i) q += i % 3 ? "\"" + std::to_string(i) + "\n\n" + std::to_string(i) + "\"\n" : "\"\"\n";
+    q.pop_back();
+    auto const q_expected = parser(quoted)(q);
+    for (std::size_t n : {2, 3, 7, 16}) REQUIRE(parser(quoted).parallel(q, n) == q_expected);
+
+    // Masks apply within and between elements as they do for the whole
+    std::string spaced = " 1 , 2 \n 3 , 4 \n 5 , 6 ";
+    REQUIRE(parser(lines, ' '_x).parallel(spaced, 3) == parser(lines, ' '_x)(spaced));
+}
+
+namespace profiled_rules {
+XF_DECLARE(number);
+XF_DECLARE(pair);
+XF_DEFINE(number) = uint_x;
+XF_DEFINE(pair) = any(seq(number, ','_x, number, ';'_x), seq(number, ','_x, number));
+}
+
+TEST_CASE("32") {
+    auto const p = parser(profiled_rules::pair / ' '_x);
+    std::string const s = "1,2 3,4; 56,7";
+    profiler prof;
+    REQUIRE(p.profile(s, prof).size() == p(s).size());
+
+    std::map<std::string, profiler::entry> e;
+    for (auto const &x : prof.flat()) e[x.name] = x;
+    REQUIRE(e.size() == 4);
+    REQUIRE(e["pair"].calls == 3);
+    REQUIRE(e["pair"].successes == 3);
+    REQUIRE(e["pair|0"].calls == 3);
+    REQUIRE(e["pair|0"].successes == 1);
+    REQUIRE(e["pair|0"].backtracked == 3 + 4); // "1,2" and "56,7" were matched before the missing ';'
+    REQUIRE(e["pair|1"].calls == 2);
+    REQUIRE(e["number"].calls == 10);
+    REQUIRE(e["pair"].cycles >= e["pair|0"].cycles);
+
+    std::ostringstream os;
+    prof.print_collapsed(os);
+    REQUIRE(os.str().find("pair;pair|1;number ") != std::string::npos);
+    os.str("");
+    prof.print_flat(os);
+    REQUIRE(os.str().find("\tpair|0\n") != std::string::npos);
+
+    // Nothing is recorded by an ordinary parse, nor once the profiled one is over
+    prof.clear();
+    p(s);
+    REQUIRE(prof.flat().empty());
+    REQUIRE(profiler::current() == nullptr);
+}
+
+TEST_CASE("33") {
+    auto const header = caseless("Content-Length");
+    REQUIRE(parser(header)(std::string("cOnTeNt-lEnGtH")) == "cOnTeNt-lEnGtH");
+    REQUIRE(parser(header).match(std::string("CONTENT-LENGTH")));
+    REQUIRE(!parser(header).match(std::string("Content_Length")));
+    REQUIRE(!parser(header).match(std::string("Content-Lengt")));
+    REQUIRE(!parser(header).match(std::list<char>{'c', 'o', 'n'}));
+    std::string const h = "content-length";
+    REQUIRE(parser(header)(std::list<char>(h.begin(), h.end())) == h);
+    REQUIRE((parser(seq(caseless("get"), ' '_x, caseless("http/1.1")))(std::string("GeT HTTP/1.1")) == hana::make_tuple(std::string("GeT"), ' ', std::string("HTTP/1.1"))));
+
+    // Every ASCII literal char against every input byte, on the vector path and the scalar one
+    bool ok = true;
+    for (unsigned l = 1; l != 0x80; ++l) {
+        char const lit[] = {static_cast<char>(l), 0};
+        auto const c = caseless_string<1>(lit);
+        for (unsigned i = 0; i != 256; ++i) {
+            bool const expected = ascii_lower(static_cast<char>(l)) == ascii_lower(static_cast<char>(i));
+            std::string s(40, static_cast<char>(i));
+            auto w = make_window(s);
+            ok = ok && parser(c).match(s.substr(0, 1)) == expected && bool(valid(c, check(check_c, c, w))) == expected;
+            ok = ok && parser(c).match(std::list<char>{static_cast<char>(i)}) == expected;
+        }
+    }
+    REQUIRE(ok);
+
+    // Longer than a block, and ending at various distances from the end of the input
+    auto const sql = caseless("select distinct name from users where id = ?");
+    std::string q = "SELECT DISTINCT Name FROM Users WHERE ID = ?";
+    for (std::size_t pad = 0; pad != 40; ++pad) {
+        REQUIRE((parser(seq(sql, *char_x))(q + std::string(pad, ' ')) == hana::make_tuple(q, std::string(pad, ' '))));
+        auto bad = q + std::string(pad, ' ');
+        bad[pad % q.size()] ^= 1;
+        REQUIRE(!parser(seq(sql, *char_x)).match(bad));
+    }
+    REQUIRE_THROWS(caseless_string<1>("\xe9"));
+
+    // Literals under a caseless window compare ASCII in blocks and anything else through to_lower
+    auto const lit = "Transfer-Encoding: Chunked \xe9t\xc9"_x;
+    for (std::size_t n = 0; n != 3; ++n) {
+        std::string in = "transfer-ENCODING: chunked \xe9t\xc9" + std::string(n, '!');
+        auto w = make_window(in, caseless_compare());
+        auto d = check(check_c, lit, w);
+        REQUIRE(d.second == (caseless_compare()('\xe9', '\xe9') && caseless_compare()('\xc9', '\xc9')));
+        REQUIRE(std::size_t(w.end() - w.begin()) == n);
+        in[5] = '_';
+        auto w2 = make_window(in, caseless_compare());
+        REQUIRE(!check(check_c, lit, w2).second);
+    }
+}
+
+TEST_CASE("34") {
+    arena memory(64);
+    memory.allocate(100, 8);
+    memory.allocate(1000, 8);
+    REQUIRE(memory.blocks() == 2);
+    memory.reset();
+    REQUIRE(memory.used() == 0);
+    memory.allocate(1000, 8);
+    REQUIRE(memory.blocks() == 2);
+    REQUIRE(memory.used() == 1000);
+    REQUIRE(arena::blocks_for(0) == 0);
+    REQUIRE(arena::blocks_for(10000, 4096) == 2);
+
+    // Check data of repeats lives in the arena
+    auto const record = *seq(size_x, ','_x);
+    std::string const one = "1,22,333,";
+    {
+        arena a;
+        auto w = make_window(one);
+        auto data = [&] {arena_scope scope(&a); return check(check_c, record, w);}();
+        REQUIRE(a.allocations() > 0);
+        auto copy = data;
+        REQUIRE(parse(parse_c, record, std::move(copy)) == parser(record)(one));
+    }
+
+    session s;
+    std::vector<std::string> inputs;
+    for (int i = 0; i != 1000; ++i) inputs.push_back(std::to_string(i) + "," + std::to_string(i * 7) + ",");
+    inputs[500] = "x";
+    auto out = parser(record, ' '_x).parse_many(inputs, s);
+    REQUIRE(out.size() == 1000);
+    REQUIRE(s.parses() == 1000);
+    bool same = true;
+    for (std::size_t i = 0; i != out.size(); ++i)
+        same = same && (i == 500 ? out[i]->empty() : bool(out[i]) && *out[i] == parser(record, ' '_x)(inputs[i]));
+    REQUIRE(same);
+    REQUIRE(s.memory().blocks() == 1);
+    REQUIRE(s.allocations_saved() == 999);
+    REQUIRE(s.allocations_saved_per_parse() > 0.99);
+
+    REQUIRE(parser(record)(one, s) == parser(record)(one));
+    REQUIRE_THROWS(parser(+seq(size_x, ','_x))(std::string("x"), s));
+    REQUIRE(arena::current() == nullptr);
+    REQUIRE(memo_table::current() == nullptr);
+}
+
+TEST_CASE("35") {
+    std::string const b("\x01\x02\x03\x04\x05\x06\x07\x08\x09", 9);
+    REQUIRE(parser(byte_x)(b) == 1);
+    REQUIRE(parser(little_word_x)(b) == 0x0201);
+    REQUIRE(parser(big_word_x)(b) == 0x0102);
+    REQUIRE(parser(little_dword_x)(b) == 0x04030201u);
+    REQUIRE(parser(big_dword_x)(b) == 0x01020304u);
+    REQUIRE(parser(little_qword_x)(b) == 0x0807060504030201ull);
+    REQUIRE(parser(big_qword_x)(b) == 0x0102030405060708ull);
+    REQUIRE(parser(big_x<std::int16_t>)(std::string("\xff\xfe", 2)) == -2);
+    REQUIRE((parser(seq(byte_x, big_qword_x))(b) == hana::make_tuple(std::uint8_t(1), 0x0203040506070809ull)));
+    REQUIRE(!parser(big_qword_x).match(b.substr(0, 7)));
+    REQUIRE(parser(*big_word_x)(b).size() == 4);
+
+    // Unaligned, from bytes that aren't chars, and from input that isn't contiguous
+    std::vector<unsigned char> u = {0, 0x3F, 0xF0, 0, 0, 0, 0, 0, 0};
+    REQUIRE((parser(seq(byte_x, big_bin_double_x))(u)[1_c] == 1.0));
+    std::list<char> l(b.begin(), b.end());
+    REQUIRE((parser(seq(big_dword_x, little_dword_x))(l) == hana::make_tuple(0x01020304u, 0x08070605u)));
+    REQUIRE(!parser(big_qword_x / byte_x).match(std::list<char>(3, 'x')));
+    float f = 1.5f;
+    std::string fs(reinterpret_cast<char const *>(&f), 4);
+    REQUIRE(parser(bin_float_x)(fs) == 1.5f);
+    std::reverse(fs.begin(), fs.end());
+    // Reversed, it reads the same in the other order
+    REQUIRE((std::is_same<native_endian_t, little_endian_t>::value ? parser(big_bin_float_x)(fs) : parser(little_bin_float_x)(fs)) == 1.5f);
+
+    // LEB128
+    auto leb = [](std::initializer_list<int> bytes) {std::string s; for (int c : bytes) s += static_cast<char>(c); return s;};
+    REQUIRE(parser(uleb128_x)(leb({0})) == 0);
+    REQUIRE(parser(uleb128_x)(leb({0xE5, 0x8E, 0x26})) == 624485);
+    REQUIRE(parser(sleb128_x)(leb({0xC0, 0xBB, 0x78})) == -123456);
+    REQUIRE(parser(sleb128_x)(leb({0x7F})) == -1);
+    REQUIRE(parser(sleb128_x)(leb({0x3F})) == 63);
+    REQUIRE(parser(uleb128_x)(leb({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01})) == ~std::uint64_t(0));
+    REQUIRE(!parser(uleb128_x).match(leb({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02})));
+    REQUIRE(!parser(uleb128_x).match(leb({0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00})));
+    REQUIRE(parser(sleb128_x)(leb({0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7F})) == std::numeric_limits<std::int64_t>::min());
+    REQUIRE(!parser(uleb128_x).match(leb({0x80})));
+    REQUIRE(!parser(leb128_parser<std::uint8_t>()).match(leb({0x80, 0x02})));
+    REQUIRE(parser(leb128_parser<std::int8_t>())(leb({0x80, 0x7F})) == -128);
+    REQUIRE(!parser(leb128_parser<std::int8_t>()).match(leb({0xFF, 0x7E})));
+
+    // Length prefixed blobs
+    std::string msg = leb({0, 3}) + "abc" + leb({5}) + "hello";
+    REQUIRE((parser(seq(blob(big_word_x), blob(uleb128_x)))(msg) == hana::make_tuple(std::string("abc"), std::string("hello"))));
+    REQUIRE(!parser(blob(big_word_x)).match(leb({0, 4}) + "abc"));
+    REQUIRE((parser(blob(byte_x))(std::vector<unsigned char>{2, 7, 8, 9}) == std::vector<unsigned char>{7, 8}));
+    REQUIRE(parser(*blob(byte_x))(leb({1}) + "a" + leb({0, 2}) + "bc").size() == 3);
+    REQUIRE(parser(blob(leb128_parser<int>()), ' '_x).match(leb({0x7F})) == false);
+}
+
+TEST_CASE("36") {
+    // Memoized parsers of the same type keep separate entries
+    auto const g = any("ab"_x % memoize, "ac"_x % memoize);
+    static_assert(std::is_same<decltype("ab"_x % memoize), decltype("ac"_x % memoize)>::value, "");
+    REQUIRE(parser(g).match(std::string("ac")));
+    REQUIRE(parser(g)(std::string("ac")).index() == 1);
+    REQUIRE(parser(*g)(std::string("abacab")).size() == 3);
+
+    memo_table memo;
+    {
+        memo_scope scope(&memo);
+        std::string const s = "ac";
+        auto w = make_window(s);
+        REQUIRE(valid(g, check(check_c, g, w)));
+    }
+    REQUIRE(memo.size() == 2);
+    REQUIRE(memo.hits() == 0);
+
+    // Memoized grammars are still made at compile time
+    constexpr auto ab = "ab"_x % memoize;
+    constexpr auto both = any(ab, "ac"_x % memoize);
+    static_assert(first(both).contains('a') && !first(both).nullable(), "");
+    REQUIRE(parser(both)(std::string("ac")).index() == 1);
+}
+
+TEST_CASE("37") {
+    // Memo entries hold check data in the session arena and must be gone before it is reset
+    auto const item = seq(+seq("ab"_x, ','_x), ';'_x);
+    auto const g = *(item % memoize);
+    std::string in;
+    for (int i = 0; i != 50; ++i) in += i % 2 ? "ab,ab,ab,;" : "ab,;";
+    auto const expected = parser(g)(in);
+    REQUIRE(expected.size() == 50);
+
+    session s(64);
+    for (int i = 0; i != 3; ++i) REQUIRE(parser(g)(in, s) == expected);
+    REQUIRE(s.parses() == 3);
+    REQUIRE(s.memory().blocks() > 1);
+    REQUIRE(arena::current() == nullptr);
+    REQUIRE(memo_table::current() == nullptr);
+}
+
+TEST_CASE("38") {
+    // Lists of cheap elements and separators keep a span too, and check the separators again
+    std::string s = "12, 345,6789 , x";
+    auto w = make_window(s, hana::equal);
+    auto ws = with_mask(w, ' '_x);
+    auto data = check(check_c, uint_x / ','_x, ws);
+    static_assert(std::is_same<decltype(data), repeat_span<decltype(ws)>>::value, "");
+    REQUIRE(data.size() == 3);
+    REQUIRE(parse(parse_c, uint_x / ','_x, data) == std::vector<unsigned>({12, 345, 6789}));
+    REQUIRE(*ws == ',');
+
+    REQUIRE(parser(alpha_x / "::"_x)(std::string("a::b::c:d")) == "abc");
+    REQUIRE(parser(uint_x / ','_x)(std::string("1,2,")) == std::vector<unsigned>({1, 2}));
+    REQUIRE(parser(uint_x / ','_x)(std::string("7")) == std::vector<unsigned>({7}));
+    REQUIRE(!parser(uint_x / ','_x).match(std::string(",1")));
+
+    // A separator which isn't cheap keeps the check data of the elements
+    auto w2 = make_window(s);
+    static_assert(!std::is_same<decltype(check(check_c, uint_x / seq(','_x, ' '_x), w2)), repeat_span<decltype(w2)>>::value, "");
+}
+
 }
@@ -13,6 +13,7 @@
 
 #include <boost/spirit/home/x3/char/char_parser.hpp>
 #include <boost/spirit/home/x3/char/detail/cast_char.hpp>
+#include <boost/spirit/home/x3/char/detail/scan.hpp>
 #include <boost/spirit/home/support/char_encoding/standard.hpp>
 #include <boost/spirit/home/support/char_encoding/standard_wide.hpp>
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
@@ -87,6 +88,19 @@ namespace boost { namespace spirit { namespace x3
         }
     };
 
+    namespace detail
+    {
+        // Runs of ASCII spaces and blanks in a char buffer are skipped
+        // 16 at a time
+        template <typename Encoding>
+        struct skip_scanner<char_class<Encoding, space_tag>>
+          : byte_skip_scanner<char_class<Encoding, space_tag>, space_bytes> {};
+
+        template <typename Encoding>
+        struct skip_scanner<char_class<Encoding, blank_tag>>
+          : byte_skip_scanner<char_class<Encoding, blank_tag>, blank_bytes> {};
+    }
+
 #define BOOST_SPIRIT_X3_CHAR_CLASS(encoding, name)                                 \
     typedef char_class<char_encoding::encoding, name##_tag> name##_type;        \
     name##_type const name = name##_type();                                     \
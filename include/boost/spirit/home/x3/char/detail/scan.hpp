@@ -0,0 +1,179 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_SCAN_OCTOBER_18_2026_0500PM)
+#define BOOST_SPIRIT_X3_SCAN_OCTOBER_18_2026_0500PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <cstring>
+
+#if !defined(BOOST_SPIRIT_X3_NO_SIMD)
+# if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define BOOST_SPIRIT_X3_SSE2
+#  include <emmintrin.h>
+# endif
+#endif
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //  Classes of bytes for running over a stretch of a char buffer. Each
+    //  tests one char, and with SSE2 gives 0xFF for each of 16 bytes that
+    //  is in the class.
+    ///////////////////////////////////////////////////////////////////////////
+
+    // ' ' and '\t' to '\r', which are spaces in every encoding and locale
+    struct space_bytes
+    {
+        bool operator()(char ch) const
+        {
+            return ch == ' ' || static_cast<unsigned char>(ch - '\t') <= '\r' - '\t';
+        }
+
+#if defined(BOOST_SPIRIT_X3_SSE2)
+        __m128i operator()(__m128i x) const
+        {
+            __m128i const t = _mm_sub_epi8(x, _mm_set1_epi8('\t'));
+            __m128i const control = _mm_cmpeq_epi8(
+                _mm_min_epu8(t, _mm_set1_epi8('\r' - '\t')), t);
+            return _mm_or_si128(control, _mm_cmpeq_epi8(x, _mm_set1_epi8(' ')));
+        }
+#endif
+    };
+
+    // ' ' and '\t'
+    struct blank_bytes
+    {
+        bool operator()(char ch) const
+        {
+            return ch == ' ' || ch == '\t';
+        }
+
+#if defined(BOOST_SPIRIT_X3_SSE2)
+        __m128i operator()(__m128i x) const
+        {
+            return _mm_or_si128(
+                _mm_cmpeq_epi8(x, _mm_set1_epi8(' '))
+              , _mm_cmpeq_epi8(x, _mm_set1_epi8('\t')));
+        }
+#endif
+    };
+
+    // One given char
+    struct equal_bytes
+    {
+        explicit equal_bytes(char ch)
+          : ch(ch) {}
+
+        bool operator()(char ch_) const
+        {
+            return ch_ == ch;
+        }
+
+#if defined(BOOST_SPIRIT_X3_SSE2)
+        __m128i operator()(__m128i x) const
+        {
+            return _mm_cmpeq_epi8(x, _mm_set1_epi8(ch));
+        }
+#endif
+
+        char ch;
+    };
+
+    inline unsigned lowest_bit(unsigned mask)
+    {
+#if defined(__GNUC__)
+        return __builtin_ctz(mask);
+#else
+        unsigned i = 0;
+        for (; !(mask & 1); mask >>= 1)
+            ++i;
+        return i;
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Move first past the bytes in the class, to the first one that
+    //  isn't or to last
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Bytes>
+    inline void skip_bytes(char const*& first, char const* last, Bytes const& in)
+    {
+#if defined(BOOST_SPIRIT_X3_SSE2)
+        for (; last - first >= 16; first += 16)
+        {
+            __m128i const x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+            unsigned const mask = ~static_cast<unsigned>(_mm_movemask_epi8(in(x))) & 0xFFFF;
+            if (mask)
+            {
+                first += lowest_bit(mask);
+                return;
+            }
+        }
+#endif
+        while (first != last && in(*first))
+            ++first;
+    }
+
+    template <typename Bytes>
+    inline void skip_bytes(char*& first, char* last, Bytes const& in)
+    {
+        char const* i = first;
+        skip_bytes(i, last, in);
+        first += i - first;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A skip_scanner for skippers that match exactly one class of bytes.
+    //  Other iterators are left for the skipper to go a character at a
+    //  time.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Skipper, typename Bytes>
+    struct byte_skip_scanner
+    {
+        template <typename Iterator>
+        static void call(Iterator&, Iterator const&, Skipper const&)
+        {
+        }
+
+        static void call(char const*& first, char const* const& last, Skipper const&)
+        {
+            skip_bytes(first, last, Bytes());
+        }
+
+        static void call(char*& first, char* const& last, Skipper const&)
+        {
+            skip_bytes(first, last, Bytes());
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Move first to the next ch, or to last if there is none
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator>
+    inline void find_char(Iterator& first, Iterator const& last, char ch)
+    {
+        while (first != last && *first != ch)
+            ++first;
+    }
+
+    inline void find_char(char const*& first, char const* const& last, char ch)
+    {
+        void const* p = std::memchr(first, ch, last - first);
+        first = p ? static_cast<char const*>(p) : last;
+    }
+
+    inline void find_char(char*& first, char* const& last, char ch)
+    {
+        void* p = std::memchr(first, ch, last - first);
+        first = p ? static_cast<char*>(p) : last;
+    }
+}}}}
+
+#endif
@@ -12,8 +12,11 @@
 #endif
 
 #include <boost/spirit/home/x3/char/char_parser.hpp>
+#include <boost/spirit/home/x3/char/detail/scan.hpp>
 #include <boost/spirit/home/x3/support/utility/utf8.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_const.hpp>
+#include <boost/utility/enable_if.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -40,6 +43,32 @@ namespace boost { namespace spirit { namespace x3
         char_type ch;
     };
 
+    namespace detail
+    {
+        // A run of the same char is skipped 16 at a time when the
+        // literal is a char
+        template <typename Encoding, typename Attribute>
+        struct skip_scanner<literal_char<Encoding, Attribute>>
+        {
+            typedef literal_char<Encoding, Attribute> skipper_type;
+            typedef typename Encoding::char_type char_type;
+
+            template <typename Iterator>
+            static void call(Iterator&, Iterator const&, skipper_type const&)
+            {
+            }
+
+            template <typename Char>
+            static void call(Char*& first, Char* const& last, skipper_type const& skipper
+              , typename enable_if<is_same<typename remove_const<Char>::type, char>>::type* = 0)
+            {
+                char const ch = static_cast<char>(skipper.ch);
+                if (char_type(ch) == skipper.ch)
+                    skip_bytes(first, last, equal_bytes(ch));
+            }
+        };
+    }
+
     template <typename Encoding, typename Attribute>
     struct get_info<literal_char<Encoding, Attribute>>
     {
@@ -0,0 +1,116 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_SPACE_COMMENT_OCTOBER_18_2026_0500PM)
+#define BOOST_SPIRIT_X3_SPACE_COMMENT_OCTOBER_18_2026_0500PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/core/skip_over.hpp>
+#include <boost/spirit/home/x3/core/parser.hpp>
+#include <boost/spirit/home/x3/support/unused.hpp>
+#include <boost/spirit/home/x3/char/detail/scan.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace boost { namespace spirit { namespace x3
+{
+    namespace detail
+    {
+        template <typename Iterator>
+        inline void skip_spaces(Iterator& first, Iterator const& last)
+        {
+            for (; first != last; ++first)
+            {
+                typename std::iterator_traits<Iterator>::value_type const ch = *first;
+                if (ch != ' ' && (ch < '\t' || ch > '\r'))
+                    break;
+            }
+        }
+
+        inline void skip_spaces(char const*& first, char const* const& last)
+        {
+            skip_bytes(first, last, space_bytes());
+        }
+
+        inline void skip_spaces(char*& first, char* const& last)
+        {
+            skip_bytes(first, last, space_bytes());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  A skipper for C-like text: any run of ASCII white space, // line
+    //  comments and /* block */ comments. A block comment with no end
+    //  isn't skipped, so that the grammar sees it and fails there.
+    //
+    //      phrase_parse(first, last, grammar, space_comment);
+    //
+    //  Char buffers are run over with memchr and SSE2 where there is
+    //  nothing else to look at.
+    ///////////////////////////////////////////////////////////////////////////
+    struct space_comment_parser : parser<space_comment_parser>
+    {
+        typedef unused_type attribute_type;
+        static bool const has_attribute = false;
+
+        template <typename Iterator, typename Context, typename Attribute>
+        bool parse(Iterator& first, Iterator const& last
+          , Context const& context, unused_type, Attribute& /*attr*/) const
+        {
+            x3::skip_over(first, last, context);
+            Iterator const start = first;
+            while (true)
+            {
+                detail::skip_spaces(first, last);
+                if (first == last || *first != '/')
+                    break;
+
+                Iterator i = first;
+                if (++i == last)
+                    break;
+                if (*i == '/') // line comment, up to the newline
+                {
+                    ++i;
+                    detail::find_char(i, last, '\n');
+                }
+                else if (*i == '*') // block comment
+                {
+                    ++i;
+                    while (true)
+                    {
+                        detail::find_char(i, last, '*');
+                        if (i == last || ++i == last)
+                            return first != start; // unterminated
+                        if (*i == '/')
+                            break;
+                    }
+                    ++i;
+                }
+                else
+                {
+                    break;
+                }
+                first = i;
+            }
+            return first != start;
+        }
+    };
+
+    template<>
+    struct get_info<space_comment_parser>
+    {
+        typedef std::string result_type;
+        result_type operator()(space_comment_parser const &) const { return "space_comment"; }
+    };
+
+    space_comment_parser const space_comment = space_comment_parser();
+}}}
+
+#endif
@@ -62,12 +62,28 @@ namespace boost { namespace spirit { namespace x3
             return unused_skipper.skipper;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Skippers that can run over a stretch of input without a parse
+        // call for each character specialize skip_scanner. call() must
+        // leave first where the skipper may not match; the skipper itself
+        // then decides.
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Skipper, typename Enable = void>
+        struct skip_scanner
+        {
+            template <typename Iterator>
+            static void call(Iterator&, Iterator const&, Skipper const&)
+            {
+            }
+        };
+
         template <typename Iterator, typename Skipper>
         inline void skip_over(
             Iterator& first, Iterator const& last, Skipper const& skipper)
         {
+            skip_scanner<Skipper>::call(first, last, skipper);
             while (first != last && skipper.parse(first, last, unused, unused, unused))
-                /***/;
+                skip_scanner<Skipper>::call(first, last, skipper);
         }
 
         template <typename Iterator>
@@ -11,6 +11,7 @@
 #include <boost/spirit/home/x3/core/skip_over.hpp>
 #include <boost/spirit/home/x3/numeric/real_policies.hpp>
 #include <boost/spirit/home/x3/support/numeric_utils/extract_real.hpp>
+#include <boost/mpl/if.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -31,7 +32,12 @@ namespace boost { namespace spirit { namespace x3
           , Context& context, unused_type, T& attr_) const
         {
             x3::skip_over(first, last, context);
-            return extract_real<T, RealPolicies>::parse(first, last, attr_, policies);
+            typedef typename mpl::if_<
+                detail::use_exact_real<T, RealPolicies>
+              , extract_exact_real<T, RealPolicies>
+              , extract_real<T, RealPolicies>>::type
+            extract;
+            return extract::parse(first, last, attr_, policies);
         }
 
         template <typename Iterator, typename Context, typename Attribute>
@@ -57,6 +63,12 @@ namespace boost { namespace spirit { namespace x3
     typedef real_parser<double> double_type;
     double_type const double_ = {};
 
+    typedef real_parser<float, exact_real_policies<float> > exact_float_type;
+    exact_float_type const exact_float_ = {};
+
+    typedef real_parser<double, exact_real_policies<double> > exact_double_type;
+    exact_double_type const exact_double_ = {};
+
 }}}
 
 #endif
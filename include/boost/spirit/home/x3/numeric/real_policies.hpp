@@ -181,6 +181,22 @@ namespace boost { namespace spirit { namespace x3
     {
         static bool const expect_dot = true;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Correctly rounded float and double: the nearest value to the digits
+    //  written, ties to even (see extract_exact_real)
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    struct exact_ureal_policies : ureal_policies<T>
+    {
+        static bool const exact = true;
+    };
+
+    template <typename T>
+    struct exact_real_policies : real_policies<T>
+    {
+        static bool const exact = true;
+    };
 }}}
 
 #endif
@@ -0,0 +1,165 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_FROZEN_TST_OCTOBER_18_2026_0900AM)
+#define BOOST_SPIRIT_X3_FROZEN_TST_OCTOBER_18_2026_0900AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/string/detail/tst.hpp>
+#include <boost/detail/iterator.hpp>
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    // An immutable copy of a tst's structure, laid out for lookups.
+    //
+    // Every trie state lives in one array, addressed by 32-bit indices.
+    // The children of a state are consecutive and sorted, so finding one
+    // is a short scan (or a binary search) of adjacent entries instead of
+    // chasing lt/gt pointers to a separately allocated node per
+    // character. Blocks of children are laid out depth first, so once a
+    // key has no more siblings its tail is contiguous. The values stay
+    // where the tst put them.
+
+    template <typename Char, typename T>
+    struct frozen_tst
+    {
+        typedef std::uint32_t index_type;
+        static index_type const npos = index_type(-1);
+
+        explicit frozen_tst(tst_node<Char, T> const* root)
+        {
+            typedef tst_node<Char, T> node;
+
+            // States still to be given their children, with the root of the
+            // TST holding those children
+            std::vector<std::pair<index_type, node const*>> pending;
+            std::vector<node const*> stack;
+            std::vector<node const*> children;
+
+            states.push_back(state{Char(), 0, 0, npos});
+            pending.push_back(std::make_pair(index_type(0), root));
+
+            while (!pending.empty())
+            {
+                index_type const s = pending.back().first;
+                node const* p = pending.back().second;
+                pending.pop_back();
+
+                BOOST_ASSERT(states.size() < npos);
+                index_type const first = index_type(states.size());
+                children.clear();
+
+                // In-order walk of the lt/gt links, giving the children
+                // in ascending order of their character
+                while (p || !stack.empty())
+                {
+                    for (; p; p = p->lt)
+                        stack.push_back(p);
+                    p = stack.back();
+                    stack.pop_back();
+
+                    index_type value = npos;
+                    if (p->data)
+                    {
+                        value = index_type(values.size());
+                        values.push_back(p->data);
+                    }
+                    states.push_back(state{p->id, 0, 0, value});
+                    children.push_back(p);
+                    p = p->gt;
+                }
+
+                states[s].first = first;
+                states[s].size = index_type(states.size()) - first;
+
+                // The first child is laid out next, so a key's tail,
+                // once it has no siblings, is contiguous
+                for (std::size_t i = children.size(); i-- != 0;)
+                    pending.push_back(std::make_pair(index_type(first + i), children[i]->eq));
+            }
+        }
+
+        template <typename Iterator, typename Filter>
+        T* find(Iterator& first, Iterator last, Filter filter) const
+        {
+            Iterator i = first;
+            Iterator latest = first;
+            index_type s = 0;
+            T* found = 0;
+
+            while (i != last)
+            {
+                typename
+                    boost::detail::iterator_traits<Iterator>::value_type
+                c = filter(*i); // filter only the input
+
+                s = child(s, c);
+                if (s == npos)
+                    break;
+                ++i;
+
+                if (states[s].value != npos)
+                {
+                    found = values[states[s].value];
+                    latest = i;
+                }
+            }
+
+            if (found)
+                first = latest; // one past the last matching char
+            return found;
+        }
+
+    private:
+
+        struct state
+        {
+            Char id;            // character leading to the state
+            index_type first;   // index of the first child
+            index_type size;    // number of children
+            index_type value;   // index into values, or npos
+        };
+
+        template <typename C>
+        index_type child(index_type s, C c) const
+        {
+            index_type const b = states[s].first;
+            index_type const e = b + states[s].size;
+            state const* const p = states.data();
+
+            // Most states have a handful of children; scan those in order
+            if (e - b <= 16)
+            {
+                for (index_type i = b; i != e; ++i)
+                {
+                    if (c == p[i].id)
+                        return i;
+                    if (c < p[i].id)
+                        break;
+                }
+                return npos;
+            }
+
+            state const* const q = std::lower_bound(p + b, p + e, c
+              , [](state const& t, C c) { return t.id < c; });
+            return (q != p + e && c == q->id) ? index_type(q - p) : npos;
+        }
+
+        std::vector<state> states;
+        std::vector<T*> values;
+    };
+}}}}
+
+#endif
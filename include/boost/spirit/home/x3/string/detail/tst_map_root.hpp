@@ -0,0 +1,190 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_TST_MAP_ROOT_OCTOBER_18_2026_1100AM)
+#define BOOST_SPIRIT_X3_TST_MAP_ROOT_OCTOBER_18_2026_1100AM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    // The first level of a tst_map: the entry for each first character.
+    // An entry is empty once both its members are null.
+    //
+    //  Data* find(c)       the entry for the (filtered) character c, or 0
+    //  Data& insert(ch)    the entry for ch, made empty if there was none
+    //  void erase(ch)
+    //  void clear()
+    //  for_each(f)         calls f(ch, data) for each entry
+
+    // Hashed, as tst_map always was
+    template <typename Char, typename Data>
+    struct tst_hash_root
+    {
+        template <typename C>
+        Data* find(C c) const
+        {
+            typename map_type::const_iterator i = map.find(c);
+            return i == map.end() ? 0 : const_cast<Data*>(&i->second);
+        }
+
+        Data& insert(Char ch)
+        {
+            return map.insert(std::make_pair(ch, Data())).first->second;
+        }
+
+        void erase(Char ch)
+        {
+            map.erase(ch);
+        }
+
+        void clear()
+        {
+            map.clear();
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (auto const& x : map)
+                f(x.first, x.second);
+        }
+
+    private:
+
+        typedef std::unordered_map<Char, Data> map_type;
+        map_type map;
+    };
+
+    // A slot for each of the 256 values of an 8-bit character
+    template <typename Char, typename Data>
+    struct tst_byte_root
+    {
+        tst_byte_root()
+          : slots()
+        {
+        }
+
+        template <typename C>
+        Data* find(C c) const
+        {
+            // Input wider than Char can't match a key
+            if (static_cast<C>(static_cast<Char>(c)) != c)
+                return 0;
+            Data const& x = slots[index(static_cast<Char>(c))];
+            return (x.root || x.data) ? const_cast<Data*>(&x) : 0;
+        }
+
+        Data& insert(Char ch)
+        {
+            return slots[index(ch)];
+        }
+
+        void erase(Char ch)
+        {
+            slots[index(ch)] = Data();
+        }
+
+        void clear()
+        {
+            std::fill(slots, slots + 256, Data());
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (int i = 0; i != 256; ++i)
+                if (slots[i].root || slots[i].data)
+                    f(static_cast<Char>(i), slots[i]);
+        }
+
+    private:
+
+        static unsigned char index(Char ch)
+        {
+            return static_cast<unsigned char>(ch);
+        }
+
+        Data slots[256];
+    };
+
+    // Entries sorted by character in one array, found by binary search
+    template <typename Char, typename Data>
+    struct tst_sorted_root
+    {
+        template <typename C>
+        Data* find(C c) const
+        {
+            typename entries_type::const_iterator i = lower_bound(c);
+            return (i != entries.end() && c == i->first)
+                ? const_cast<Data*>(&i->second) : 0;
+        }
+
+        Data& insert(Char ch)
+        {
+            typename entries_type::iterator i = lower_bound(ch);
+            if (i == entries.end() || ch != i->first)
+                i = entries.insert(i, std::make_pair(ch, Data()));
+            return i->second;
+        }
+
+        void erase(Char ch)
+        {
+            typename entries_type::iterator i = lower_bound(ch);
+            if (i != entries.end() && ch == i->first)
+                entries.erase(i);
+        }
+
+        void clear()
+        {
+            entries.clear();
+        }
+
+        template <typename F>
+        void for_each(F f) const
+        {
+            for (auto const& x : entries)
+                f(x.first, x.second);
+        }
+
+    private:
+
+        typedef std::vector<std::pair<Char, Data>> entries_type;
+
+        template <typename C>
+        typename entries_type::iterator lower_bound(C c)
+        {
+            return std::lower_bound(entries.begin(), entries.end(), c
+              , [](std::pair<Char, Data> const& x, C c) { return x.first < c; });
+        }
+
+        template <typename C>
+        typename entries_type::const_iterator lower_bound(C c) const
+        {
+            return std::lower_bound(entries.begin(), entries.end(), c
+              , [](std::pair<Char, Data> const& x, C c) { return x.first < c; });
+        }
+
+        entries_type entries;
+    };
+
+    // Direct slots for 8-bit characters, a sorted array for wider ones
+    template <typename Char, typename Data>
+    using tst_map_root = typename std::conditional<
+        sizeof(Char) == 1
+      , tst_byte_root<Char, Data>
+      , tst_sorted_root<Char, Data>>::type;
+}}}}
+
+#endif
@@ -150,6 +150,13 @@ namespace boost { namespace spirit { namespace x3
             lookup->clear();
         }
 
+        // Compile the entries into a contiguous trie for faster lookups
+        // (see tst::freeze); the copies sharing this lookup share that too
+        void freeze()
+        {
+            lookup->freeze();
+        }
+
         struct adder;
         struct remover;
 
@@ -12,6 +12,9 @@
 #endif
 
 #include <boost/spirit/home/x3/string/detail/tst.hpp>
+#include <boost/spirit/home/x3/string/detail/frozen_tst.hpp>
+
+#include <memory>
 
 namespace boost { namespace spirit { namespace x3
 {
@@ -30,6 +33,7 @@ namespace boost { namespace spirit { namespace x3
         typedef Char char_type; // the character type
         typedef T value_type; // the value associated with each entry
         typedef detail::tst_node<Char, T> node;
+        typedef detail::frozen_tst<Char, T> frozen_type;
 
         tst()
           : root(0)
@@ -55,6 +59,8 @@ namespace boost { namespace spirit { namespace x3
         template <typename Iterator, typename Filter>
         T* find(Iterator& first, Iterator last, Filter filter) const
         {
+            if (frozen)
+                return frozen->find(first, last, filter);
             return node::find(root, first, last, filter);
         }
 
@@ -70,21 +76,49 @@ namespace boost { namespace spirit { namespace x3
           , Iterator last
           , typename boost::call_traits<T>::param_type val)
         {
+            if (frozen)
+            {
+                // Adding a key already there leaves the structure as it is
+                Iterator i = first;
+                if (T* p = frozen->find(i, last, tst_pass_through()))
+                    if (i == last)
+                        return p;
+                thaw();
+            }
             return node::add(root, first, last, val, this);
         }
 
         template <typename Iterator>
         void remove(Iterator first, Iterator last)
         {
+            thaw();
             node::remove(root, first, last, this);
         }
 
         void clear()
         {
+            thaw();
             node::destruct_node(root, this);
             root = 0;
         }
 
+        // Lay the current keys out for faster lookups. Adding a new key or
+        // removing one goes back to the node structure until the next freeze.
+        void freeze()
+        {
+            frozen.reset(new frozen_type(root));
+        }
+
+        void thaw()
+        {
+            frozen.reset();
+        }
+
+        bool is_frozen() const
+        {
+            return frozen != 0;
+        }
+
         template <typename F>
         void for_each(F f) const
         {
@@ -98,6 +132,8 @@ namespace boost { namespace spirit { namespace x3
         void copy(tst const& rhs)
         {
             root = node::clone_node(rhs.root, this);
+            if (rhs.frozen)
+                freeze();
         }
 
         tst& assign(tst const& rhs)
@@ -111,6 +147,7 @@ namespace boost { namespace spirit { namespace x3
         }
 
         node* root;
+        std::unique_ptr<frozen_type> frozen;
 
         node* new_node(Char id)
         {
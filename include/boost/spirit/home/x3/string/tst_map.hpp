@@ -12,14 +12,21 @@
 #endif
 
 #include <boost/spirit/home/x3/string/detail/tst.hpp>
-#include <unordered_map>
+#include <boost/spirit/home/x3/string/detail/tst_map_root.hpp>
 #include <boost/pool/object_pool.hpp>
 
 namespace boost { namespace spirit { namespace x3
 {
     struct tst_pass_through; // declared in tst.hpp
 
-    template <typename Char, typename T>
+    // A TST for the characters after the first of each key. The Root holds
+    // an entry for each first character; by default that is 256 direct
+    // slots for 8-bit characters and a sorted array for wider ones, and
+    // detail::tst_hash_root gives the unordered_map it used to be.
+    template <
+        typename Char
+      , typename T
+      , template <typename, typename> class Root = detail::tst_map_root>
     struct tst_map
     {
         typedef Char char_type; // the character type
@@ -52,18 +59,15 @@ namespace boost { namespace spirit { namespace x3
             if (first != last)
             {
                 Iterator save = first;
-                typename map_type::const_iterator
-                    i = map.find(filter(*first++));
-                if (i == map.end())
+                map_data const* x = map.find(filter(*first++));
+                if (x)
                 {
-                    first = save;
-                    return 0;
+                    if (T* p = node::find(x->root, first, last, filter))
+                        return p;
+                    if (x->data)
+                        return x->data;
                 }
-                if (T* p = node::find(i->second.root, first, last, filter))
-                {
-                    return p;
-                }
-                return i->second.data;
+                first = save;
             }
             return 0;
         }
@@ -82,20 +86,18 @@ namespace boost { namespace spirit { namespace x3
         {
             if (first != last)
             {
-                map_data x = {0, 0};
-                std::pair<typename map_type::iterator, bool>
-                    r = map.insert(std::pair<Char, map_data>(*first++, x));
+                map_data& x = map.insert(*first++);
 
                 if (first != last)
                 {
-                    return node::add(r.first->second.root
+                    return node::add(x.root
                       , first, last, val, this) ? true : false;
                 }
                 else
                 {
-                    if (r.first->second.data)
+                    if (x.data)
                         return false;
-                    r.first->second.data = this->new_data(val);
+                    x.data = this->new_data(val);
                 }
                 return true;
             }
@@ -107,21 +109,21 @@ namespace boost { namespace spirit { namespace x3
         {
             if (first != last)
             {
-                typename map_type::iterator i = map.find(*first++);
-                if (i != map.end())
+                Char ch = *first++;
+                if (map_data* x = map.find(ch))
                 {
                     if (first != last)
                     {
-                        node::remove(i->second.root, first, last, this);
+                        node::remove(x->root, first, last, this);
                     }
-                    else if (i->second.data)
+                    else if (x->data)
                     {
-                        this->delete_data(i->second.data);
-                        i->second.data = 0;
+                        this->delete_data(x->data);
+                        x->data = 0;
                     }
-                    if (i->second.data == 0 && i->second.root == 0)
+                    if (x->data == 0 && x->root == 0)
                     {
-                        map.erase(i);
+                        map.erase(ch);
                     }
                 }
             }
@@ -129,25 +131,25 @@ namespace boost { namespace spirit { namespace x3
 
         void clear()
         {
-            BOOST_FOREACH(typename map_type::value_type& x, map)
+            map.for_each([this](Char, map_data const& x)
             {
-                node::destruct_node(x.second.root, this);
-                if (x.second.data)
-                    this->delete_data(x.second.data);
-            }
+                node::destruct_node(x.root, this);
+                if (x.data)
+                    this->delete_data(x.data);
+            });
             map.clear();
         }
 
         template <typename F>
         void for_each(F f) const
         {
-            BOOST_FOREACH(typename map_type::value_type const& x, map)
+            map.for_each([&f](Char ch, map_data const& x)
             {
-                std::basic_string<Char> s(1, x.first);
-                node::for_each(x.second.root, s, f);
-                if (x.second.data)
-                    f(s, *x.second.data);
-            }
+                std::basic_string<Char> s(1, ch);
+                node::for_each(x.root, s, f);
+                if (x.data)
+                    f(s, *x.data);
+            });
         }
 
     private:
@@ -160,27 +162,27 @@ namespace boost { namespace spirit { namespace x3
             T* data;
         };
 
-        typedef std::unordered_map<Char, map_data> map_type;
+        typedef Root<Char, map_data> map_type;
 
         void copy(tst_map const& rhs)
         {
-            BOOST_FOREACH(typename map_type::value_type const& x, rhs.map)
+            rhs.map.for_each([this](Char ch, map_data const& x)
             {
-                map_data xx = {node::clone_node(x.second.root, this), 0};
-                if (x.second.data)
-                    xx.data = data_pool.construct(*x.second.data);
-                map[x.first] = xx;
-            }
+                map_data xx = {node::clone_node(x.root, this), 0};
+                if (x.data)
+                    xx.data = data_pool.construct(*x.data);
+                map.insert(ch) = xx;
+            });
         }
 
         tst_map& assign(tst_map const& rhs)
         {
             if (this != &rhs)
             {
-                BOOST_FOREACH(typename map_type::value_type& x, map)
+                map.for_each([this](Char, map_data const& x)
                 {
-                    node::destruct_node(x.second.root, this);
-                }
+                    node::destruct_node(x.root, this);
+                });
                 map.clear();
                 copy(rhs);
             }
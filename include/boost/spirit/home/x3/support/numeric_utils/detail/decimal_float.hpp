@@ -0,0 +1,333 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_DECIMAL_FLOAT_OCTOBER_18_2026_1300PM)
+#define BOOST_SPIRIT_X3_DECIMAL_FLOAT_OCTOBER_18_2026_1300PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/spirit/home/x3/support/numeric_utils/detail/powers_of_five.hpp>
+#include <boost/cstdint.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    // This file contains the conversion of a decimal number, given as its
+    // significant digits and a power of ten, to the nearest float or
+    // double, rounding ties to even. Not for public consumption.
+
+    template <typename T>
+    struct binary_format;
+
+    template <>
+    struct binary_format<double>
+    {
+        typedef boost::uint64_t bits_type;
+        static int const mantissa_bits = 52;
+        static int const minimum_exponent = -1023;
+        static int const infinite_power = 0x7FF;
+        static int const min_round_to_even = -4;
+        static int const max_round_to_even = 23;
+        static int const smallest_power_of_ten = -342;
+        static int const largest_power_of_ten = 308;
+        static int const max_exact_power = 22;
+        static int const max_digits = 769;
+
+        static double exact_power(int q)
+        {
+            static double const powers[] =
+            {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+            };
+            return powers[q];
+        }
+    };
+
+    template <>
+    struct binary_format<float>
+    {
+        typedef boost::uint32_t bits_type;
+        static int const mantissa_bits = 23;
+        static int const minimum_exponent = -127;
+        static int const infinite_power = 0xFF;
+        static int const min_round_to_even = -17;
+        static int const max_round_to_even = 10;
+        static int const smallest_power_of_ten = -65;
+        static int const largest_power_of_ten = 38;
+        static int const max_exact_power = 10;
+        static int const max_digits = 114;
+
+        static float exact_power(int q)
+        {
+            static float const powers[] =
+            {
+                1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+            };
+            return powers[q];
+        }
+    };
+
+    struct uint128
+    {
+        boost::uint64_t high;
+        boost::uint64_t low;
+    };
+
+    inline uint128
+    full_multiply(boost::uint64_t a, boost::uint64_t b)
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 const r = static_cast<unsigned __int128>(a) * b;
+        uint128 x = {static_cast<boost::uint64_t>(r >> 64), static_cast<boost::uint64_t>(r)};
+#else
+        boost::uint64_t const a0 = a & 0xFFFFFFFF, a1 = a >> 32;
+        boost::uint64_t const b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+        boost::uint64_t const w0 = a0 * b0;
+        boost::uint64_t const t = a1 * b0 + (w0 >> 32);
+        boost::uint64_t const w1 = (t & 0xFFFFFFFF) + a0 * b1;
+        uint128 x = {a1 * b1 + (t >> 32) + (w1 >> 32), a * b};
+#endif
+        return x;
+    }
+
+    inline int
+    leading_zeros(boost::uint64_t w)
+    {
+#if defined(__GNUC__)
+        return __builtin_clzll(w);
+#else
+        int n = 0;
+        for (; !(w >> 63); w <<= 1)
+            ++n;
+        return n;
+#endif
+    }
+
+    // A mantissa without its hidden bit, and the biased binary exponent
+    struct adjusted_mantissa
+    {
+        boost::uint64_t mantissa;
+        int power2;
+
+        bool operator==(adjusted_mantissa const& rhs) const
+        {
+            return mantissa == rhs.mantissa && power2 == rhs.power2;
+        }
+
+        bool operator!=(adjusted_mantissa const& rhs) const
+        {
+            return !(*this == rhs);
+        }
+    };
+
+    // Eisel-Lemire: the nearest binary value to w * 10^q for an exactly
+    // known w. The second, lower multiplication settles every case (see
+    // Mushtak and Lemire, "Fast number parsing without fallback", 2023).
+    template <typename T>
+    adjusted_mantissa
+    compute_float(boost::int64_t q, boost::uint64_t w)
+    {
+        typedef binary_format<T> format;
+        adjusted_mantissa a = {0, 0};
+        if (w == 0 || q < format::smallest_power_of_ten)
+            return a;
+        if (q > format::largest_power_of_ten)
+        {
+            a.power2 = format::infinite_power;
+            return a;
+        }
+
+        int const lz = leading_zeros(w);
+        w <<= lz;
+        std::size_t const index = static_cast<std::size_t>(2 * (q - smallest_power_of_five));
+        uint128 product = full_multiply(w, powers_of_five<>::table[index]);
+        boost::uint64_t const precision_mask =
+            ~boost::uint64_t(0) >> (format::mantissa_bits + 3);
+        if ((product.high & precision_mask) == precision_mask)
+        {
+            uint128 const low = full_multiply(w, powers_of_five<>::table[index + 1]);
+            product.low += low.high;
+            if (low.high > product.low)
+                ++product.high;
+        }
+
+        int const upper = static_cast<int>(product.high >> 63);
+        int const shift = upper + 64 - format::mantissa_bits - 3;
+        a.mantissa = product.high >> shift;
+        // floor(log2(10^q)) + 63, exact over the whole table
+        a.power2 = static_cast<int>((((152170 + 65536) * q) >> 16) + 63)
+            + upper - lz - format::minimum_exponent;
+
+        if (a.power2 <= 0) // subnormal
+        {
+            if (-a.power2 + 1 >= 64)
+            {
+                a.mantissa = 0;
+                a.power2 = 0;
+                return a;
+            }
+            a.mantissa >>= -a.power2 + 1;
+            a.mantissa += a.mantissa & 1;
+            a.mantissa >>= 1;
+            a.power2 = a.mantissa < (boost::uint64_t(1) << format::mantissa_bits) ? 0 : 1;
+            return a;
+        }
+
+        // Exactly halfway: round to even
+        if (product.low <= 1
+            && q >= format::min_round_to_even && q <= format::max_round_to_even
+            && (a.mantissa & 3) == 1 && (a.mantissa << shift) == product.high)
+        {
+            a.mantissa &= ~boost::uint64_t(1);
+        }
+        a.mantissa += a.mantissa & 1;
+        a.mantissa >>= 1;
+        if (a.mantissa >= (boost::uint64_t(2) << format::mantissa_bits))
+        {
+            a.mantissa = boost::uint64_t(1) << format::mantissa_bits;
+            ++a.power2;
+        }
+        a.mantissa &= ~(boost::uint64_t(1) << format::mantissa_bits);
+        if (a.power2 >= format::infinite_power)
+        {
+            a.mantissa = 0;
+            a.power2 = format::infinite_power;
+        }
+        return a;
+    }
+
+    template <typename T>
+    typename binary_format<T>::bits_type
+    to_bits(adjusted_mantissa a)
+    {
+        return static_cast<typename binary_format<T>::bits_type>(
+            a.mantissa | (boost::uint64_t(a.power2) << binary_format<T>::mantissa_bits));
+    }
+
+    template <typename T>
+    T
+    from_bits(typename binary_format<T>::bits_type bits)
+    {
+        T t;
+        std::memcpy(&t, &bits, sizeof(T));
+        return t;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  Just enough of an unsigned big integer to compare a long decimal
+    //  number with the point halfway between two floats
+    ///////////////////////////////////////////////////////////////////////////
+    struct bigint
+    {
+        explicit bigint(boost::uint64_t n = 0)
+        {
+            for (; n; n >>= 32)
+                limbs.push_back(static_cast<boost::uint32_t>(n));
+        }
+
+        void multiply_add(boost::uint32_t m, boost::uint32_t a = 0)
+        {
+            boost::uint64_t carry = a;
+            for (std::size_t i = 0; i != limbs.size(); ++i)
+            {
+                carry += boost::uint64_t(limbs[i]) * m;
+                limbs[i] = static_cast<boost::uint32_t>(carry);
+                carry >>= 32;
+            }
+            if (carry)
+                limbs.push_back(static_cast<boost::uint32_t>(carry));
+        }
+
+        void multiply_pow5(unsigned n)
+        {
+            for (; n >= 13; n -= 13)
+                multiply_add(1220703125); // 5^13
+            static boost::uint32_t const small[] =
+                {1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625};
+            if (n)
+                multiply_add(small[n]);
+        }
+
+        void shift_left(unsigned n)
+        {
+            if (limbs.empty())
+                return;
+            unsigned const words = n / 32, bits = n % 32;
+            if (bits)
+            {
+                boost::uint32_t carry = 0;
+                for (std::size_t i = 0; i != limbs.size(); ++i)
+                {
+                    boost::uint32_t const next = limbs[i] >> (32 - bits);
+                    limbs[i] = (limbs[i] << bits) | carry;
+                    carry = next;
+                }
+                if (carry)
+                    limbs.push_back(carry);
+            }
+            limbs.insert(limbs.begin(), words, 0);
+        }
+
+        int compare(bigint const& rhs) const
+        {
+            if (limbs.size() != rhs.limbs.size())
+                return limbs.size() < rhs.limbs.size() ? -1 : 1;
+            for (std::size_t i = limbs.size(); i-- != 0;)
+                if (limbs[i] != rhs.limbs[i])
+                    return limbs[i] < rhs.limbs[i] ? -1 : 1;
+            return 0;
+        }
+
+        std::vector<boost::uint32_t> limbs; // least significant first
+    };
+
+    // Round digits * 10^exp10 given the nearest value below it, a, and
+    // whether any nonzero digits followed those in digits. Only the
+    // comparison with the halfway point between a and its successor
+    // decides which of the two it is.
+    template <typename T>
+    typename binary_format<T>::bits_type
+    round_digits(adjusted_mantissa a, bigint digits, int exp10, bool more)
+    {
+        typedef binary_format<T> format;
+        boost::uint64_t m = a.mantissa;
+        int exp2 = 1 + format::minimum_exponent - format::mantissa_bits;
+        if (a.power2 > 0)
+        {
+            m |= boost::uint64_t(1) << format::mantissa_bits;
+            exp2 += a.power2 - 1;
+        }
+
+        // halfway = (2m + 1) * 2^(exp2 - 1)
+        // and digits * 10^exp10 = digits * 5^exp10 * 2^exp10
+        bigint halfway(2 * m + 1);
+        int const left2 = exp10, right2 = exp2 - 1;
+        if (exp10 >= 0)
+            digits.multiply_pow5(static_cast<unsigned>(exp10));
+        else
+            halfway.multiply_pow5(static_cast<unsigned>(-exp10));
+        if (left2 > right2)
+            digits.shift_left(static_cast<unsigned>(left2 - right2));
+        else
+            halfway.shift_left(static_cast<unsigned>(right2 - left2));
+
+        int c = digits.compare(halfway);
+        if (c == 0 && more)
+            c = 1;
+        typename format::bits_type bits = to_bits<T>(a);
+        if (c > 0 || (c == 0 && (m & 1)))
+            ++bits; // carries into the exponent as it should
+        return bits;
+    }
+}}}}
+
+#endif
@@ -0,0 +1,99 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#if !defined(BOOST_SPIRIT_X3_DIGIT_BLOCKS_OCTOBER_18_2026_0300PM)
+#define BOOST_SPIRIT_X3_DIGIT_BLOCKS_OCTOBER_18_2026_0300PM
+
+#if defined(_MSC_VER)
+#pragma once
+#endif
+
+#include <boost/cstdint.hpp>
+
+// Digits are read eight at a time from one 64-bit load, which needs the
+// first character in the lowest byte. Define BOOST_SPIRIT_X3_NO_DIGIT_BLOCKS
+// to always go a character at a time.
+#if !defined(BOOST_SPIRIT_X3_NO_DIGIT_BLOCKS)
+# if (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__) \
+    || defined(_M_IX86) || defined(_M_X64)
+#  define BOOST_SPIRIT_X3_DIGIT_BLOCKS
+# endif
+#endif
+
+namespace boost { namespace spirit { namespace x3 { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    //  Eight digits at once: v holds eight characters, the first one in
+    //  its lowest byte.
+    //
+    //      Test whether all eight are digits:
+    //
+    //          static bool is_valid(boost::uint64_t v);
+    //
+    //      Their value, which is less than power:
+    //
+    //          static boost::uint64_t value(boost::uint64_t v);
+    //
+    ///////////////////////////////////////////////////////////////////////////
+    template <unsigned Radix>
+    struct digit_blocks;
+
+    template <>
+    struct digit_blocks<10>
+    {
+        static boost::uint64_t const power = 100000000;
+
+        inline static bool is_valid(boost::uint64_t v)
+        {
+            // each byte is 0x3N, and N + 6 doesn't carry out of the nibble
+            return ((v & 0xF0F0F0F0F0F0F0F0ull)
+                | (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+                    == 0x3333333333333333ull;
+        }
+
+        inline static boost::uint64_t value(boost::uint64_t v)
+        {
+            // pairs, then fours, then all eight, with three multiplies
+            v -= 0x3030303030303030ull;
+            v = v * 10 + (v >> 8);
+            return ((v & 0x000000FF000000FFull) * (100 + (1000000ull << 32))
+                + ((v >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32))) >> 32;
+        }
+    };
+
+    template <>
+    struct digit_blocks<16>
+    {
+        static boost::uint64_t const power = 0x100000000ull;
+
+        inline static bool is_valid(boost::uint64_t v)
+        {
+            // With no byte over 0x7F nothing below carries across bytes.
+            // Adding 0x80 - lo sets the top bit of bytes >= lo, and adding
+            // 0x7F - hi sets it for bytes > hi.
+            boost::uint64_t const top = 0x8080808080808080ull;
+            boost::uint64_t const lower = v | 0x2020202020202020ull;
+            boost::uint64_t const digit = (v + 0x5050505050505050ull)
+                & ~(v + 0x4646464646464646ull);
+            boost::uint64_t const letter = (lower + 0x1F1F1F1F1F1F1F1Full)
+                & ~(lower + 0x1919191919191919ull);
+            return (v & top) == 0 && ((digit | letter) & top) == top;
+        }
+
+        inline static boost::uint64_t value(boost::uint64_t v)
+        {
+            // a nibble per byte: '0' to '9' are 0x3N, and 'a' to 'f' and
+            // 'A' to 'F' are 0x6N and 0x4N for N = 1 to 6
+            v = (v & 0x0F0F0F0F0F0F0F0Full) + ((v >> 6) & 0x0101010101010101ull) * 9;
+            v = ((v << 4) | (v >> 8)) & 0x00FF00FF00FF00FFull;
+            v = ((v << 8) | (v >> 16)) & 0x0000FFFF0000FFFFull;
+            return ((v << 16) | (v >> 32)) & 0xFFFFFFFFull;
+        }
+    };
+}}}}
+
+#endif
@@ -19,6 +19,7 @@
 #include <boost/spirit/home/x3/support/traits/attribute_type.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/spirit/home/x3/support/traits/numeric_traits.hpp>
+#include <boost/spirit/home/x3/support/numeric_utils/detail/digit_blocks.hpp>
 #include <boost/spirit/home/support/char_encoding/ascii.hpp>
 
 #include <boost/preprocessor/repetition/repeat.hpp>
@@ -37,6 +38,9 @@
 #include <boost/mpl/bool.hpp>
 #include <boost/mpl/and.hpp>
 #include <boost/limits.hpp>
+#include <boost/cstdint.hpp>
+
+#include <cstring>
 
 #if !defined(SPIRIT_NUMERICS_LOOP_UNROLL)
 # define SPIRIT_NUMERICS_LOOP_UNROLL 3
@@ -151,6 +155,19 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             n += static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint64_t block) // checked
+        {
+            // Ensure n * power + block will not overflow
+            boost::uint64_t const power = digit_blocks<Radix>::power;
+            boost::uint64_t const max = (std::numeric_limits<T>::max)();
+            if (static_cast<boost::uint64_t>(n) > (max - block) / power)
+                return false;
+
+            n = static_cast<T>(static_cast<boost::uint64_t>(n) * power + block);
+            return true;
+        }
     };
 
     template <unsigned Radix>
@@ -182,6 +199,23 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             n -= static_cast<T>(digit);
             return true;
         }
+
+        template <typename T>
+        inline static bool add_block(T& n, boost::uint64_t block) // checked
+        {
+            if (!std::numeric_limits<T>::is_signed)
+                return false;
+
+            // Ensure n * power - block will not underflow
+            boost::int64_t const power = digit_blocks<Radix>::power;
+            boost::int64_t const min = (std::numeric_limits<T>::min)();
+            boost::int64_t const digits = static_cast<boost::int64_t>(block);
+            if (static_cast<boost::int64_t>(n) < (min + digits) / power)
+                return false;
+
+            n = static_cast<T>(static_cast<boost::int64_t>(n) * power - digits);
+            return true;
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -265,6 +299,68 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Digits from a contiguous char buffer are taken eight at a time,
+    //  with one overflow check for each block, for as long as no more
+    //  than max_digits are taken. A block that would overflow is left for
+    //  the loop below to deal with a character at a time. Returns the
+    //  number of digits consumed.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Iterator, typename T, unsigned Radix>
+    struct use_digit_blocks : mpl::false_ {};
+
+#if defined(BOOST_SPIRIT_X3_DIGIT_BLOCKS)
+    template <typename T, unsigned Radix>
+    struct use_digit_blocks<char const*, T, Radix>
+      : mpl::bool_<
+            (Radix == 10 || Radix == 16)
+         && is_integral<T>::value
+         && sizeof(T) <= sizeof(boost::uint64_t)
+         && digits_traits<T, Radix>::value >= 8
+        > {};
+
+    template <typename T, unsigned Radix>
+    struct use_digit_blocks<char*, T, Radix>
+      : use_digit_blocks<char const*, T, Radix> {};
+#endif
+
+    template <unsigned Radix, typename Accumulator>
+    struct digit_block_extractor
+    {
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& it, Iterator const& last, T& n, std::size_t max_digits)
+        {
+            return call(it, last, n, max_digits
+              , use_digit_blocks<Iterator, T, Radix>());
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator& it, Iterator const& last, T& n, std::size_t max_digits
+          , mpl::true_)
+        {
+            typedef digit_blocks<Radix> blocks;
+            Iterator const start = it;
+            for (boost::uint64_t v; max_digits >= 8 && last - it >= 8
+              ; it += 8, max_digits -= 8)
+            {
+                std::memcpy(&v, it, 8);
+                if (!blocks::is_valid(v)
+                    || !Accumulator::add_block(n, blocks::value(v)))
+                    break;
+            }
+            return static_cast<std::size_t>(it - start);
+        }
+
+        template <typename Iterator, typename T>
+        inline static std::size_t
+        call(Iterator&, Iterator const&, T&, std::size_t, mpl::false_)
+        {
+            return 0;
+        }
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     //  extract_int: main code for extracting integers
     ///////////////////////////////////////////////////////////////////////////
@@ -320,7 +416,9 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             attribute_type;
 
             attribute_type val = Accumulate ? attr : attribute_type(0);
-            std::size_t count = 0;
+            std::size_t count = digit_block_extractor<Radix, Accumulator>::call(
+                it, last, val, MaxDigits < 0 ? std::size_t(-1)
+                  : static_cast<std::size_t>(MaxDigits) - leading_zeros);
             char_type ch;
 
             while (true)
@@ -427,19 +525,29 @@ namespace boost { namespace spirit { namespace x3 { namespace detail
             attribute_type;
 
             attribute_type val = Accumulate ? attr : attribute_type(0);
-            char_type ch = *it;
+            char_type ch;
 
-            if (!radix_check::is_valid(ch) || !extractor::call(ch, 0, val))
+            if (std::size_t const blocks =
+                digit_block_extractor<Radix, Accumulator>::call(
+                    it, last, val, std::size_t(-1)))
             {
-                if (count == 0) // must have at least one digit
-                    return false;
-                traits::move_to(val, attr);
-                first = it;
-                return true;
+                count = blocks - 1;
             }
+            else
+            {
+                ch = *it;
+                if (!radix_check::is_valid(ch) || !extractor::call(ch, 0, val))
+                {
+                    if (count == 0) // must have at least one digit
+                        return false;
+                    traits::move_to(val, attr);
+                    first = it;
+                    return true;
+                }
 
-            count = 0;
-            ++it;
+                count = 0;
+                ++it;
+            }
             while (true)
             {
                 BOOST_PP_REPEAT(
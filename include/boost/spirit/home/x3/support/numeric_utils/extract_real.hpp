@@ -16,9 +16,12 @@
 #include <cmath>
 #include <boost/limits.hpp>
 #include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/utility/enable_if.hpp>
 #include <boost/spirit/home/x3/support/unused.hpp>
 #include <boost/spirit/home/x3/support/numeric_utils/pow10.hpp>
 #include <boost/spirit/home/x3/support/numeric_utils/sign.hpp>
+#include <boost/spirit/home/x3/support/numeric_utils/detail/decimal_float.hpp>
 #include <boost/spirit/home/x3/support/traits/move_to.hpp>
 #include <boost/assert.hpp>
 
@@ -262,6 +265,237 @@ namespace boost { namespace spirit { namespace x3
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    //  Policies asking for exact conversion have a static bool exact = true.
+    //  Only float and double are converted that way; other types are given
+    //  to extract_real.
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        template <typename RealPolicies, typename Enable = void>
+        struct has_exact_policy : mpl::false_ {};
+
+        template <typename RealPolicies>
+        struct has_exact_policy<RealPolicies
+              , typename enable_if_c<RealPolicies::exact>::type>
+          : mpl::true_ {};
+
+        template <typename T, typename RealPolicies>
+        struct use_exact_real
+          : mpl::bool_<
+                has_exact_policy<RealPolicies>::value
+             && (is_same<T, double>::value || is_same<T, float>::value)>
+        {};
+
+        // Up to 19 significant digits, the power of ten scaling them, and
+        // whether any nonzero digits were dropped after those
+        struct decimal_number
+        {
+            decimal_number()
+              : digits(0), kept(0), exponent(0), explicit_exponent(0)
+              , truncated(false) {}
+
+            void add(unsigned d, bool fraction)
+            {
+                if (kept == 0 && d == 0)        // leading zero
+                {
+                    exponent -= fraction;
+                }
+                else if (kept < 19)
+                {
+                    digits = digits * 10 + d;
+                    ++kept;
+                    exponent -= fraction;
+                }
+                else
+                {
+                    truncated |= d != 0;
+                    exponent += !fraction;
+                }
+            }
+
+            boost::uint64_t digits;
+            int kept;
+            boost::int64_t exponent;
+            int explicit_exponent;
+            bool truncated;
+        };
+
+        template <typename Iterator>
+        inline bool
+        parse_decimal_digits(Iterator& first, Iterator const& last
+          , decimal_number& d, bool fraction)
+        {
+            Iterator const save = first;
+            for (; first != last && *first >= '0' && *first <= '9'; ++first)
+                d.add(static_cast<unsigned>(*first - '0'), fraction);
+            return first != save;
+        }
+
+        // All the digits, for the rare number the first 19 don't settle
+        template <typename T, typename Iterator>
+        typename binary_format<T>::bits_type
+        round_all_digits(adjusted_mantissa a, Iterator first, Iterator last
+          , int explicit_exponent)
+        {
+            bigint n;
+            int digits = 0;
+            int exp10 = explicit_exponent;
+            bool fraction = false, more = false;
+            for (; first != last; ++first)
+            {
+                if (*first < '0' || *first > '9')
+                {
+                    fraction = true;            // the decimal point
+                    continue;
+                }
+                unsigned const d = static_cast<unsigned>(*first - '0');
+                if (digits == 0 && d == 0)
+                {
+                    exp10 -= fraction;
+                }
+                else if (digits < binary_format<T>::max_digits)
+                {
+                    n.multiply_add(10, d);
+                    ++digits;
+                    exp10 -= fraction;
+                }
+                else
+                {
+                    more |= d != 0;
+                    exp10 += !fraction;
+                }
+            }
+            return round_digits<T>(a, n, exp10, more);
+        }
+
+        template <typename T, typename Iterator>
+        T
+        decimal_to_float(decimal_number const& d, Iterator first, Iterator last)
+        {
+            typedef binary_format<T> format;
+
+            // Clinger: both factors are exact, so one rounding gives the answer
+            if (!d.truncated
+                && d.exponent >= -format::max_exact_power
+                && d.exponent <= format::max_exact_power
+                && d.digits <= (boost::uint64_t(2) << format::mantissa_bits))
+            {
+                T n = static_cast<T>(d.digits);
+                int const e = static_cast<int>(d.exponent);
+                return e < 0 ? n / format::exact_power(-e) : n * format::exact_power(e);
+            }
+
+            adjusted_mantissa const a = compute_float<T>(d.exponent, d.digits);
+            // With digits dropped the value lies between the first 19 and
+            // the next number up; if those round apart, look at them all
+            if (d.truncated && a != compute_float<T>(d.exponent, d.digits + 1))
+                return from_bits<T>(round_all_digits<T>(a, first, last, d.explicit_exponent));
+            return from_bits<T>(to_bits<T>(a));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  The same syntax as extract_real, correctly rounded. The significant
+    //  digits are gathered into a 64-bit integer and converted with the
+    //  Eisel-Lemire algorithm; a big integer comparison settles numbers
+    //  whose first 19 digits aren't enough. The policies' parse_n and
+    //  parse_frac_n are not used.
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename RealPolicies>
+    struct extract_exact_real
+    {
+        template <typename Iterator, typename Attribute>
+        static bool
+        parse(Iterator& first, Iterator const& last, Attribute& attr,
+            RealPolicies const& p)
+        {
+            if (first == last)
+                return false;
+            Iterator save = first;
+
+            bool neg = p.parse_sign(first, last);
+
+            Iterator const digits_first = first;
+            detail::decimal_number d;
+            bool got_a_number = detail::parse_decimal_digits(first, last, d, false);
+
+            if (!got_a_number)
+            {
+                T n = 0;
+                if (p.parse_nan(first, last, n) ||
+                    p.parse_inf(first, last, n))
+                {
+                    traits::move_to(extension::negate(neg, n), attr);
+                    return true;
+                }
+
+                if (!p.allow_leading_dot)
+                {
+                    first = save;
+                    return false;
+                }
+            }
+
+            bool e_hit = false;
+            bool got_a_fraction = false;
+            Iterator digits_last = first;
+
+            if (p.parse_dot(first, last))
+            {
+                got_a_fraction = detail::parse_decimal_digits(first, last, d, true);
+                if (!got_a_fraction && (!got_a_number || !p.allow_trailing_dot))
+                {
+                    first = save;
+                    return false;
+                }
+                digits_last = first;
+                e_hit = p.parse_exp(first, last);
+            }
+            else
+            {
+                if (!got_a_number)
+                {
+                    first = save;
+                    return false;
+                }
+
+                e_hit = p.parse_exp(first, last);
+                if (p.expect_dot && !e_hit)
+                {
+                    first = save;
+                    return false;
+                }
+            }
+
+            if (e_hit)
+            {
+                if (!p.parse_exp_n(first, last, d.explicit_exponent))
+                {
+                    first = save;
+                    return false;
+                }
+                d.exponent += d.explicit_exponent;
+            }
+            else if (!got_a_fraction && !d.truncated
+                && d.digits == 1 && d.exponent == 0)
+            {
+                // One of the 1.0#INF styles for NaN or Inf?
+                T n = 0;
+                if (p.parse_nan(first, last, n) ||
+                    p.parse_inf(first, last, n))
+                {
+                    traits::move_to(extension::negate(neg, n), attr);
+                    return true;
+                }
+            }
+
+            T const n = detail::decimal_to_float<T>(d, digits_first, digits_last);
+            traits::move_to(extension::negate(neg, n), attr);
+            return true;
+        }
+    };
+
 #if BOOST_WORKAROUND(BOOST_MSVC, >= 1400)
 # pragma warning(pop)
 #endif
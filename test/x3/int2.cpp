@@ -0,0 +1,197 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include "int.hpp"
+#include <boost/spirit/home/x3/numeric/uint.hpp>
+#include <boost/cstdint.hpp>
+
+#include <iostream>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Long runs of digits from a char const*, which are read eight at a time,
+//  must parse just like they do a character at a time
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+    boost::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    boost::uint64_t next_random()
+    {
+        // xorshift64*
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    int failures = 0;
+
+    // std::string::const_iterator goes a character at a time
+    template <typename T, typename Parser>
+    bool same_as_one_at_a_time(std::string const& s, Parser const& p)
+    {
+        char const* first = s.c_str();
+        std::string::const_iterator i = s.begin();
+        T a = 0, b = 0;
+        bool const ra = boost::spirit::x3::parse(first, s.c_str() + s.size(), p, a);
+        bool const rb = boost::spirit::x3::parse(i, s.end(), p, b);
+        bool const ok = ra == rb && first - s.c_str() == i - s.begin() && (!ra || a == b);
+        if (!ok && ++failures < 10)
+            std::cerr << s << std::endl;
+        return ok;
+    }
+
+    std::string random_number(char const* digits)
+    {
+        static char const* const ends[] =
+            {"", "", ":", "/", "g", "G", "@", "`", "\x80", " 1", "-"};
+
+        std::string s;
+        switch (next_random() % 4)
+        {
+            case 0: s += '-'; break;
+            case 1: s += '+'; break;
+        }
+        s.append(next_random() % 4 == 0 ? next_random() % 12 : 0, '0');
+
+        std::size_t const radix = std::char_traits<char>::length(digits);
+        std::size_t const n = next_random() % 26;
+        for (std::size_t i = 0; i != n; ++i)
+            s += digits[next_random() % radix];
+        if (next_random() % 8 == 0 && !s.empty()) // a bad character inside
+            s[next_random() % s.size()] = ends[next_random() % 11][0];
+        return s + ends[next_random() % 11];
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::x3::uint_;
+    using boost::spirit::x3::int_;
+    using boost::spirit::x3::long_long;
+    using boost::spirit::x3::ulong_long;
+    using boost::spirit::x3::hex;
+    using boost::spirit::x3::short_;
+    using boost::spirit::x3::int_parser;
+    using boost::spirit::x3::uint_parser;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  values at the edges of eight digit blocks
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        unsigned u;
+        BOOST_TEST(test_attr("12345678", uint_, u) && u == 12345678);
+        BOOST_TEST(test_attr("123456789", uint_, u) && u == 123456789);
+        BOOST_TEST(test_attr("00000000123456789", uint_, u) && u == 123456789);
+        BOOST_TEST(test_attr("4294967295", uint_, u) && u == 4294967295u);
+        BOOST_TEST(!test("4294967296", uint_));
+        BOOST_TEST(!test("42949672950", uint_));
+        BOOST_TEST(test_attr("1234567x", uint_, u, false) && u == 1234567);
+        BOOST_TEST(test_attr("12345678x", uint_, u, false) && u == 12345678);
+
+        boost::uint64_t ull;
+        BOOST_TEST(test_attr("18446744073709551615", ulong_long, ull)
+            && ull == 18446744073709551615ull);
+        BOOST_TEST(!test("18446744073709551616", ulong_long));
+        BOOST_TEST(test_attr("0000000000000000000000018446744073709551615", ulong_long, ull)
+            && ull == 18446744073709551615ull);
+
+        long long ll;
+        BOOST_TEST(test_attr("9223372036854775807", long_long, ll)
+            && ll == 9223372036854775807ll);
+        BOOST_TEST(test_attr("-9223372036854775808", long_long, ll)
+            && ll == (std::numeric_limits<long long>::min)());
+        BOOST_TEST(!test("9223372036854775808", long_long));
+        BOOST_TEST(!test("-9223372036854775809", long_long));
+
+        int i;
+        BOOST_TEST(test_attr("-2147483648", int_, i)
+            && i == (std::numeric_limits<int>::min)());
+        BOOST_TEST(!test("-2147483649", int_));
+        BOOST_TEST(test_attr("-12345678", int_, i) && i == -12345678);
+
+        short s;
+        BOOST_TEST(test_attr("00000000000032767", short_, s) && s == 32767);
+        BOOST_TEST(!test("32768000", short_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  hexadecimal blocks
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        unsigned u;
+        BOOST_TEST(test_attr("DeadBeef", hex, u) && u == 0xDEADBEEF);
+        BOOST_TEST(test_attr("0123abCD", hex, u) && u == 0x0123ABCD);
+        BOOST_TEST(test_attr("fFfFfFfF", hex, u) && u == 0xFFFFFFFF);
+        BOOST_TEST(!test("100000000", hex));
+        BOOST_TEST(test_attr("abcdefg", hex, u, false) && u == 0xABCDEF);
+        BOOST_TEST(test_attr("abcdef0G", hex, u, false) && u == 0xABCDEF0);
+
+        boost::uint64_t ull;
+        uint_parser<boost::uint64_t, 16> const hex64 = {};
+        BOOST_TEST(test_attr("0123456789abcdef", hex64, ull)
+            && ull == 0x0123456789ABCDEFull);
+        BOOST_TEST(test_attr("FEDCBA9876543210", hex64, ull)
+            && ull == 0xFEDCBA9876543210ull);
+        BOOST_TEST(!test("10000000000000000", hex64));
+
+        boost::int64_t ll;
+        int_parser<boost::int64_t, 16> const shex64 = {};
+        BOOST_TEST(test_attr("-8000000000000000", shex64, ll)
+            && ll == (std::numeric_limits<boost::int64_t>::min)());
+        BOOST_TEST(!test("8000000000000000", shex64));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  MaxDigits counts the digits read in blocks and the leading zeros
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        boost::uint64_t ull;
+        uint_parser<boost::uint64_t, 10, 1, 12> const uint12 = {};
+        BOOST_TEST(test_attr("123456789012345", uint12, ull, false)
+            && ull == 123456789012ull);
+        BOOST_TEST(test_attr("000012345678901", uint12, ull, false)
+            && ull == 12345678ull);
+
+        uint_parser<boost::uint64_t, 10, 10, 10> const uint10 = {};
+        BOOST_TEST(test_attr("1234567890", uint10, ull) && ull == 1234567890ull);
+        BOOST_TEST(!test("123456789", uint10));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  random numbers, in blocks and a character at a time
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        char const* const decimal = "0123456789";
+        char const* const hexadecimal = "0123456789abcdefABCDEF";
+        uint_parser<boost::uint64_t, 16> const hex64 = {};
+        int_parser<boost::int64_t, 16> const shex64 = {};
+        uint_parser<boost::uint64_t, 10, 1, 12> const uint12 = {};
+        int_parser<int, 10, 3, 17> const int17 = {};
+
+        for (int i = 0; i != 20000; ++i)
+        {
+            std::string const d = random_number(decimal);
+            BOOST_TEST((same_as_one_at_a_time<unsigned>(d, uint_)));
+            BOOST_TEST((same_as_one_at_a_time<int>(d, int_)));
+            BOOST_TEST((same_as_one_at_a_time<boost::uint64_t>(d, ulong_long)));
+            BOOST_TEST((same_as_one_at_a_time<long long>(d, long_long)));
+            BOOST_TEST((same_as_one_at_a_time<boost::uint64_t>(d, uint12)));
+            BOOST_TEST((same_as_one_at_a_time<int>(d, int17)));
+
+            std::string const h = random_number(hexadecimal);
+            BOOST_TEST((same_as_one_at_a_time<unsigned>(h, hex)));
+            BOOST_TEST((same_as_one_at_a_time<boost::uint64_t>(h, hex64)));
+            BOOST_TEST((same_as_one_at_a_time<boost::int64_t>(h, shex64)));
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,282 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+
+#include "real.hpp"
+#include "real_corpus.hpp"
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Correctly rounded conversions (exact_double_ and exact_float_), checked
+//  bit for bit against the C library
+///////////////////////////////////////////////////////////////////////////////
+namespace
+{
+    boost::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    boost::uint64_t next_random()
+    {
+        // xorshift64*
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    template <typename T, typename Bits>
+    Bits bits_of(T t)
+    {
+        Bits b;
+        std::memcpy(&b, &t, sizeof(T));
+        return b;
+    }
+
+    template <typename T, typename Bits>
+    T from_bits(Bits b)
+    {
+        T t;
+        std::memcpy(&t, &b, sizeof(T));
+        return t;
+    }
+
+    int failures = 0;
+
+    // The string must parse in full to the bits strtod or strtof give
+    bool same_as_libc(std::string const& s, double)
+    {
+        double d;
+        double const expected = std::strtod(s.c_str(), 0);
+        bool const ok = spirit_test::test_attr(s.c_str(), boost::spirit::x3::exact_double_, d)
+            && bits_of<double, boost::uint64_t>(d) == bits_of<double, boost::uint64_t>(expected);
+        if (!ok && ++failures < 10)
+            std::cerr << "double: " << s << std::endl;
+        return ok;
+    }
+
+    bool same_as_libc(std::string const& s, float)
+    {
+        float f;
+        float const expected = std::strtof(s.c_str(), 0);
+        bool const ok = spirit_test::test_attr(s.c_str(), boost::spirit::x3::exact_float_, f)
+            && bits_of<float, boost::uint32_t>(f) == bits_of<float, boost::uint32_t>(expected);
+        if (!ok && ++failures < 10)
+            std::cerr << "float: " << s << std::endl;
+        return ok;
+    }
+
+    std::string format(char const* fmt, double d)
+    {
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), fmt, d);
+        return buf;
+    }
+
+    // Every digit of the point halfway between x and the next value up,
+    // which is exact in long double for doubles and in double for floats
+    std::string halfway(double x)
+    {
+        long double const h = (static_cast<long double>(x)
+            + static_cast<long double>(std::nextafter(x, HUGE_VAL))) / 2;
+        char buf[1200];
+        std::snprintf(buf, sizeof(buf), "%.1100Le", h);
+        return buf;
+    }
+
+    std::string halfway(float x)
+    {
+        double const h = (static_cast<double>(x)
+            + static_cast<double>(std::nextafter(x, HUGE_VALF))) / 2;
+        char buf[256];
+        std::snprintf(buf, sizeof(buf), "%.200e", h);
+        return buf;
+    }
+
+    // The same number with its mantissa nudged up or down past the last
+    // nonzero digit
+    std::string nudged(std::string s, bool up)
+    {
+        std::string::size_type const e = s.find('e');
+        if (!up)
+        {
+            // take one off the last nonzero digit and make the rest 9s
+            std::string::size_type j = e - 1;
+            while (s[j] == '0' || s[j] == '.')
+                --j;
+            --s[j];
+            for (++j; j != e; ++j)
+                if (s[j] != '.')
+                    s[j] = '9';
+        }
+        s.insert(e, up ? "1" : "9");
+        return s;
+    }
+
+    boost::spirit::x3::exact_double_type exact_parser(double)
+    {
+        return boost::spirit::x3::exact_double_;
+    }
+
+    boost::spirit::x3::exact_float_type exact_parser(float)
+    {
+        return boost::spirit::x3::exact_float_;
+    }
+
+    template <typename T, typename Bits>
+    void check_value(T x)
+    {
+        if (!(x >= 0) || !(x < std::numeric_limits<T>::infinity()))
+            return;
+
+        int const digits = sizeof(T) == 8 ? 17 : 9;
+        char fmt[16];
+        for (int p = digits - 2; p <= digits; ++p)
+        {
+            std::snprintf(fmt, sizeof(fmt), "%%.%dg", p);
+            std::string const s = format(fmt, x);
+            BOOST_TEST((same_as_libc(s, x)));
+            BOOST_TEST((same_as_libc("-" + s, x)));
+        }
+
+        // round trip
+        T y;
+        std::snprintf(fmt, sizeof(fmt), "%%.%dg", digits);
+        BOOST_TEST((spirit_test::test_attr(format(fmt, x).c_str()
+          , exact_parser(x), y) && bits_of<T, Bits>(y) == bits_of<T, Bits>(x)));
+
+        if (x < std::numeric_limits<T>::max())
+        {
+            std::string const h = halfway(x);
+            BOOST_TEST((same_as_libc(h, x)));
+            BOOST_TEST((same_as_libc(nudged(h, true), x)));
+            BOOST_TEST((same_as_libc(nudged(h, false), x)));
+        }
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::x3::exact_double_;
+    using boost::spirit::x3::exact_float_;
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  same syntax as double_
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        double d;
+        BOOST_TEST((test_attr("1234", exact_double_, d) && d == 1234));
+        BOOST_TEST((test_attr("-1.5", exact_double_, d) && d == -1.5));
+        BOOST_TEST((test_attr("+.5", exact_double_, d) && d == 0.5));
+        BOOST_TEST((test_attr("5.", exact_double_, d) && d == 5));
+        BOOST_TEST((test_attr("1e3", exact_double_, d) && d == 1000));
+        BOOST_TEST((test_attr("1.2E-3", exact_double_, d) && d == 1.2e-3));
+        BOOST_TEST((test_attr("-0", exact_double_, d) && d == 0 && std::signbit(d)));
+        BOOST_TEST((test_attr("0.000", exact_double_, d) && d == 0));
+        BOOST_TEST((test_attr("nan", exact_double_, d) && boost::math::isnan(d)));
+        BOOST_TEST((test_attr("-inf", exact_double_, d) && boost::math::isinf(d) && d < 0));
+        BOOST_TEST((test_attr("1.0#INF", exact_double_, d, false) && d == 1));
+        BOOST_TEST((!test(".", exact_double_)));
+        BOOST_TEST((!test("e3", exact_double_)));
+        BOOST_TEST((!test("1e", exact_double_)));
+        BOOST_TEST((!test("-", exact_double_)));
+        BOOST_TEST((test("1.5e3x", exact_double_, false)));
+
+        // values double_ rounds wrongly
+        BOOST_TEST((test_attr("2.2250738585072011e-308", exact_double_, d)
+            && d == 2.2250738585072011e-308));
+        BOOST_TEST((test_attr("9007199254740993", exact_double_, d)
+            && d == 9007199254740992.0));
+        BOOST_TEST((test_attr("1e-400", exact_double_, d) && d == 0));
+        BOOST_TEST((test_attr("1e400", exact_double_, d) && boost::math::isinf(d)));
+        BOOST_TEST((test_attr("4.9406564584124654e-324", exact_double_, d)
+            && d == std::numeric_limits<double>::denorm_min()));
+        BOOST_TEST((test_attr("1.7976931348623157e308", exact_double_, d)
+            && d == std::numeric_limits<double>::max()));
+        BOOST_TEST((test_attr("1.7976931348623159e308", exact_double_, d)
+            && boost::math::isinf(d)));
+
+        float f;
+        BOOST_TEST((test_attr("3.4028235e38", exact_float_, f)
+            && f == std::numeric_limits<float>::max()));
+        BOOST_TEST((test_attr("1.4e-45", exact_float_, f)
+            && f == std::numeric_limits<float>::denorm_min()));
+        BOOST_TEST((test_attr("16777217", exact_float_, f) && f == 16777216.0f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  long numbers, which need more than the first 19 digits
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        BOOST_TEST((same_as_libc("9007199254740993.0000000000000000000000000001", 0.0)));
+        BOOST_TEST((same_as_libc("9007199254740992.9999999999999999999999999999", 0.0)));
+        BOOST_TEST((same_as_libc("0.000000000000000000000000000000000000000000"
+            "0000000000000000123456789012345678901234567890e-250", 0.0)));
+        BOOST_TEST((same_as_libc(std::string(400, '1') + "e-700", 0.0)));
+        BOOST_TEST((same_as_libc(std::string(400, '9') + "." + std::string(400, '9'), 0.0)));
+        BOOST_TEST((same_as_libc("1" + std::string(2000, '0') + "e-2000", 0.0)));
+        BOOST_TEST((same_as_libc("0." + std::string(1000, '0') + "1e1000", 0.0)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  the corpus xf's double_x and float_x are tested against as well
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        for (std::size_t i = 0; i != spirit_test::real_corpus_size; ++i)
+        {
+            spirit_test::real_case const& c = spirit_test::real_corpus[i];
+            double d;
+            float f;
+            BOOST_TEST((test_attr(c.text, exact_double_, d)
+                && bits_of<double, boost::uint64_t>(d) == c.double_bits));
+            BOOST_TEST((test_attr(c.text, exact_float_, f)
+                && bits_of<float, boost::uint32_t>(f) == c.float_bits));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  every float at a stride through all of them, and every float in the
+    //  subnormal range and at the top of the range
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        boost::uint32_t const top = bits_of<float, boost::uint32_t>(std::numeric_limits<float>::max());
+        for (boost::uint32_t b = 0; b <= top; b += 65537)
+            check_value<float, boost::uint32_t>(from_bits<float>(b));
+        for (boost::uint32_t b = 0; b != 1 << 16; ++b)
+            check_value<float, boost::uint32_t>(from_bits<float>(b));
+        for (boost::uint32_t b = top - (1 << 12); b <= top; ++b)
+            check_value<float, boost::uint32_t>(from_bits<float>(b));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    //  random doubles, with random bits and random decimal strings
+    ///////////////////////////////////////////////////////////////////////////
+    {
+        for (int i = 0; i != 20000; ++i)
+            check_value<double, boost::uint64_t>(from_bits<double>(next_random() >> 1));
+
+        for (int i = 0; i != 20000; ++i)
+        {
+            std::string s = std::to_string(next_random());
+            s += '.';
+            s += std::to_string(next_random());
+            s += 'e';
+            s += std::to_string(static_cast<int>(next_random() % 700) - 360);
+            BOOST_TEST((same_as_libc(s, 0.0)));
+            BOOST_TEST((same_as_libc(s, 0.0f)));
+        }
+    }
+
+    return boost::report_errors();
+}
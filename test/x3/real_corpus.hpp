@@ -0,0 +1,283 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Use, modification and distribution is subject to the Boost Software
+    License, Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+    http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_TEST_X3_REAL_CORPUS_HPP)
+#define BOOST_SPIRIT_TEST_X3_REAL_CORPUS_HPP
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+//  Decimal strings that are hard to round, with the bits of the nearest
+//  double and float as strtod and strtof give them: halfway points, the
+//  same nudged up and down past their last digit, subnormals and the edges
+//  of overflow. x3's exact_double_ and exact_float_ and xf's double_x and
+//  float_x each carry a copy of the conversion, and both test suites read
+//  this list, so it depends on nothing.
+///////////////////////////////////////////////////////////////////////////////
+namespace spirit_test
+{
+    struct real_case
+    {
+        char const* text;
+        unsigned long long double_bits;
+        unsigned long float_bits;
+    };
+
+    real_case const real_corpus[] =
+    {
+        {"0", 0x0000000000000000ull, 0x00000000ul},
+        {"-0", 0x8000000000000000ull, 0x80000000ul},
+        {"1", 0x3FF0000000000000ull, 0x3F800000ul},
+        {"-1", 0xBFF0000000000000ull, 0xBF800000ul},
+        {"0.1", 0x3FB999999999999Aull, 0x3DCCCCCDul},
+        {"0.2", 0x3FC999999999999Aull, 0x3E4CCCCDul},
+        {"0.3", 0x3FD3333333333333ull, 0x3E99999Aul},
+        {"-2.5", 0xC004000000000000ull, 0xC0200000ul},
+        {"1e23", 0x44B52D02C7E14AF6ull, 0x65A96816ul},
+        {"8.98846567431158e307", 0x7FE0000000000000ull, 0x7F800000ul},
+        {"9007199254740993", 0x4340000000000000ull, 0x5A000000ul},
+        {"9007199254740995", 0x4340000000000002ull, 0x5A000000ul},
+        {"18014398509481985", 0x4350000000000000ull, 0x5A800000ul},
+        {"2.2250738585072011e-308", 0x000FFFFFFFFFFFFFull, 0x00000000ul},
+        {"2.2250738585072012e-308", 0x0010000000000000ull, 0x00000000ul},
+        {"2.2250738585072014e-308", 0x0010000000000000ull, 0x00000000ul},
+        {"4.9406564584124654e-324", 0x0000000000000001ull, 0x00000000ul},
+        {"2.4703282292062327e-324", 0x0000000000000000ull, 0x00000000ul},
+        {"2.4703282292062328e-324", 0x0000000000000001ull, 0x00000000ul},
+        {"1e-320", 0x00000000000007E8ull, 0x00000000ul},
+        {"3e-324", 0x0000000000000001ull, 0x00000000ul},
+        {"1e-400", 0x0000000000000000ull, 0x00000000ul},
+        {"1e-330", 0x0000000000000000ull, 0x00000000ul},
+        {"1.7976931348623157e308", 0x7FEFFFFFFFFFFFFFull, 0x7F800000ul},
+        {"1.7976931348623158e308", 0x7FEFFFFFFFFFFFFFull, 0x7F800000ul},
+        {"1.7976931348623159e308", 0x7FF0000000000000ull, 0x7F800000ul},
+        {"1e308", 0x7FE1CCF385EBC8A0ull, 0x7F800000ul},
+        {"1e309", 0x7FF0000000000000ull, 0x7F800000ul},
+        {"1.00000000000000011102230246251565404236316680908203125", 0x3FF0000000000000ull, 0x3F800000ul},
+        {"1.00000000000000011102230246251565404236316680908203126", 0x3FF0000000000001ull, 0x3F800000ul},
+        {"0.000000000000000000000000000000000000000000001e45", 0x3FF0000000000000ull, 0x3F800000ul},
+        {"123456789012345678901234567890e-10", 0x43E56A95319D63E1ull, 0x5F2B54AAul},
+        {"3.14159265358979323846264338327950288419716939937510", 0x400921FB54442D18ull, 0x40490FDBul},
+        {"2.71828182845904523536028747135266249775724709369995", 0x4005BF0A8B145769ull, 0x402DF854ul},
+        {"7.038531e-26", 0x3AB5C87FB0000000ull, 0x15AE43FDul},
+        {"4.35679e-10", 0x3DFDF08BC834A2A0ull, 0x2FEF845Eul},
+        {"1.4e-45", 0x369FF868BF4D956Aull, 0x00000001ul},
+        {"7e-46", 0x368FF868BF4D956Aull, 0x00000000ul},
+        {"7.1e-46", 0x369036AA2680F22Cull, 0x00000001ul},
+        {"1e-45", 0x3696D601AD376AB9ull, 0x00000001ul},
+        {"1e-46", 0x366244CE242C5561ull, 0x00000000ul},
+        {"1.17549435e-38", 0x380FFFFFFF9FDBA8ull, 0x00800000ul},
+        {"1.1754942e-38", 0x380FFFFFBB1DD6A1ull, 0x007FFFFFul},
+        {"3.4028235e38", 0x47EFFFFFE54DAFF8ull, 0x7F7FFFFFul},
+        {"3.4028236e38", 0x47EFFFFFF514A7BCull, 0x7F800000ul},
+        {"3.40282357e38", 0x47EFFFFFF058F701ull, 0x7F800000ul},
+        {"1e38", 0x47D2CED32A16A1B1ull, 0x7E967699ul},
+        {"1e39", 0x48078287F49C4A1Dull, 0x7F800000ul},
+        {"16777217", 0x4170000010000000ull, 0x4B800000ul},
+        {"16777219", 0x4170000030000000ull, 0x4B800002ul},
+        {"33554435", 0x4180000018000000ull, 0x4C000001ul},
+        {"1.00000005960464477539062499", 0x3FF0000010000000ull, 0x3F800000ul},
+        {"1.000000059604644775390625", 0x3FF0000010000000ull, 0x3F800000ul},
+        {"1.00000005960464477539062501", 0x3FF0000010000000ull, 0x3F800001ul},
+        {"3.40282356779733661637539395458142568448e38", 0x47EFFFFFF0000000ull, 0x7F800000ul},
+        {"3.40282356779733661637539395458142568447e38", 0x47EFFFFFF0000000ull, 0x7F7FFFFFul},
+        {"3.40282356779733661637539395458142568449e38", 0x47EFFFFFF0000000ull, 0x7F800000ul},
+        {
+            "0.00000000000000000000000000000000000000000000000000000000000001e62"
+          , 0x3FF0000000000000ull, 0x3F800000ul},
+        {
+            "7.41098468761869816264853189302332058547589703921487146638378523751013"
+            "2609053131277979497545424539885696948470431685765963899850655339096945"
+            "9816219401617281718945106978546710679176872575177347315553307795408549"
+            "8096084575009581113730347476580968710095909754422710047573078097111189"
+            "3578483867565399878350301522805593404659373979179073872386829939581848"
+            "1660169122019456499931289798411362062484498678713572180352209017023903"
+            "2857917325202205289740208029068540216066123755499834026713000358124864"
+            "7904138574340187552090159017259254714629617513415977493871857473787096"
+            "1645638908718119841271673056017045493004705269590165763776884908267986"
+            "9725733665217655679410725087643375608460039849049721491174630855395563"
+            "54188641513168478436313080237596295773983001708984375e-324"
+          , 0x0000000000000002ull, 0x00000000ul},
+        {
+            "7.41098468761869816264853189302332058547589703921487146638378523751013"
+            "2609053131277979497545424539885696948470431685765963899850655339096945"
+            "9816219401617281718945106978546710679176872575177347315553307795408549"
+            "8096084575009581113730347476580968710095909754422710047573078097111189"
+            "3578483867565399878350301522805593404659373979179073872386829939581848"
+            "1660169122019456499931289798411362062484498678713572180352209017023903"
+            "2857917325202205289740208029068540216066123755499834026713000358124864"
+            "7904138574340187552090159017259254714629617513415977493871857473787096"
+            "1645638908718119841271673056017045493004705269590165763776884908267986"
+            "9725733665217655679410725087643375608460039849049721491174630855395563"
+            "541886415131684784363130802375962957739830017089843751e-324"
+          , 0x0000000000000002ull, 0x00000000ul},
+        {
+            "7.41098468761869816264853189302332058547589703921487146638378523751013"
+            "2609053131277979497545424539885696948470431685765963899850655339096945"
+            "9816219401617281718945106978546710679176872575177347315553307795408549"
+            "8096084575009581113730347476580968710095909754422710047573078097111189"
+            "3578483867565399878350301522805593404659373979179073872386829939581848"
+            "1660169122019456499931289798411362062484498678713572180352209017023903"
+            "2857917325202205289740208029068540216066123755499834026713000358124864"
+            "7904138574340187552090159017259254714629617513415977493871857473787096"
+            "1645638908718119841271673056017045493004705269590165763776884908267986"
+            "9725733665217655679410725087643375608460039849049721491174630855395563"
+            "541886415131684784363130802375962957739830017089843749e-324"
+          , 0x0000000000000001ull, 0x00000000ul},
+        {
+            "2.22507385850720113605740979670913197593481954635164564802342610972482"
+            "2222021076945516529523908135087914149158913039621106870086438694594645"
+            "5276572074078206217433799881410632673292535522868813721490129811224514"
+            "5188984905722230728525513315575501591439747639798341180199932396254828"
+            "9017107081850690630666655994938275772572015763062690663332647565300009"
+            "2458883164330377797918696120494973903778297049050510806099407302629371"
+            "2895895000358379996720725430436028407889577179615094551674824347103070"
+            "2609144621572289880258182545180325707018860872113128079512233426288368"
+            "6223215037756666225039825343359745688844239002654981983854879482922068"
+            "9472168983109969836584681402285424333066033985088644580400103493397042"
+            "756718644338377048603786162277173854562306587467901408672332763671875e"
+            "-308"
+          , 0x0010000000000000ull, 0x00000000ul},
+        {
+            "2.22507385850720113605740979670913197593481954635164564802342610972482"
+            "2222021076945516529523908135087914149158913039621106870086438694594645"
+            "5276572074078206217433799881410632673292535522868813721490129811224514"
+            "5188984905722230728525513315575501591439747639798341180199932396254828"
+            "9017107081850690630666655994938275772572015763062690663332647565300009"
+            "2458883164330377797918696120494973903778297049050510806099407302629371"
+            "2895895000358379996720725430436028407889577179615094551674824347103070"
+            "2609144621572289880258182545180325707018860872113128079512233426288368"
+            "6223215037756666225039825343359745688844239002654981983854879482922068"
+            "9472168983109969836584681402285424333066033985088644580400103493397042"
+            "7567186443383770486037861622771738545623065874679014086723327636718751"
+            "e-308"
+          , 0x0010000000000000ull, 0x00000000ul},
+        {
+            "2.22507385850720113605740979670913197593481954635164564802342610972482"
+            "2222021076945516529523908135087914149158913039621106870086438694594645"
+            "5276572074078206217433799881410632673292535522868813721490129811224514"
+            "5188984905722230728525513315575501591439747639798341180199932396254828"
+            "9017107081850690630666655994938275772572015763062690663332647565300009"
+            "2458883164330377797918696120494973903778297049050510806099407302629371"
+            "2895895000358379996720725430436028407889577179615094551674824347103070"
+            "2609144621572289880258182545180325707018860872113128079512233426288368"
+            "6223215037756666225039825343359745688844239002654981983854879482922068"
+            "9472168983109969836584681402285424333066033985088644580400103493397042"
+            "7567186443383770486037861622771738545623065874679014086723327636718749"
+            "e-308"
+          , 0x000FFFFFFFFFFFFFull, 0x00000000ul},
+        {
+            "2.22507385850720163012305563795567615250361241457301801308322872404958"
+            "6647606759446192036794116886953213985520549032000903434781884412325572"
+            "1843675633476170205181759989229413936299667425982858999948301489714335"
+            "5557856769327930601597818316214242506796246078529588519927249357768832"
+            "0732492479924816869232247165964934329258783950102250973957579510571600"
+            "7383436457384943241929970921792073899197616943141314971732652550200849"
+            "9797367678374315520581880443916381057236779117517775622749741380425338"
+            "7084478193655533073867420834526162513029462022730109054820067654020201"
+            "5471120020281397001415752591234401773622442737124681517501897455599786"
+            "5323425588621961151633592416795802960447706494647018477736093430045142"
+            "168360701364747951396213837722826145437693412532098591327667236328125e"
+            "-308"
+          , 0x0010000000000000ull, 0x00000000ul},
+        {
+            "2.22507385850720163012305563795567615250361241457301801308322872404958"
+            "6647606759446192036794116886953213985520549032000903434781884412325572"
+            "1843675633476170205181759989229413936299667425982858999948301489714335"
+            "5557856769327930601597818316214242506796246078529588519927249357768832"
+            "0732492479924816869232247165964934329258783950102250973957579510571600"
+            "7383436457384943241929970921792073899197616943141314971732652550200849"
+            "9797367678374315520581880443916381057236779117517775622749741380425338"
+            "7084478193655533073867420834526162513029462022730109054820067654020201"
+            "5471120020281397001415752591234401773622442737124681517501897455599786"
+            "5323425588621961151633592416795802960447706494647018477736093430045142"
+            "1683607013647479513962138377228261454376934125320985913276672363281251"
+            "e-308"
+          , 0x0010000000000001ull, 0x00000000ul},
+        {
+            "2.22507385850720163012305563795567615250361241457301801308322872404958"
+            "6647606759446192036794116886953213985520549032000903434781884412325572"
+            "1843675633476170205181759989229413936299667425982858999948301489714335"
+            "5557856769327930601597818316214242506796246078529588519927249357768832"
+            "0732492479924816869232247165964934329258783950102250973957579510571600"
+            "7383436457384943241929970921792073899197616943141314971732652550200849"
+            "9797367678374315520581880443916381057236779117517775622749741380425338"
+            "7084478193655533073867420834526162513029462022730109054820067654020201"
+            "5471120020281397001415752591234401773622442737124681517501897455599786"
+            "5323425588621961151633592416795802960447706494647018477736093430045142"
+            "1683607013647479513962138377228261454376934125320985913276672363281249"
+            "e-308"
+          , 0x0010000000000000ull, 0x00000000ul},
+        {"1.00000000000000011102230246251565404236316680908203125e+00", 0x3FF0000000000000ull, 0x3F800000ul},
+        {"1.000000000000000111022302462515654042363166809082031251e+00", 0x3FF0000000000001ull, 0x3F800000ul},
+        {"1.000000000000000111022302462515654042363166809082031249e+00", 0x3FF0000000000000ull, 0x3F800000ul},
+        {"9.007199254740993e+15", 0x4340000000000000ull, 0x5A000000ul},
+        {"9.0071992547409931e+15", 0x4340000000000001ull, 0x5A000000ul},
+        {"9.0071992547409929e+15", 0x4340000000000000ull, 0x5A000000ul},
+        {"1e+23", 0x44B52D02C7E14AF6ull, 0x65A96816ul},
+        {"11e+23", 0x44ED1DE3D2D5C713ull, 0x6768EF1Ful},
+        {"09e+23", 0x44E7D2A320DD7455ull, 0x673E9519ul},
+        {
+            "1.79769313486231560835325876058105298516207002341652166261661174625869"
+            "5532672923265745300992879465492467506314903358770175220871059269879629"
+            "0627760473556921329019091915239418047621712533496094635638726128664019"
+            "8029037799514183602981511756283727771403830521483963923935633133642802"
+            "139091669457927874464075218944e+308"
+          , 0x7FEFFFFFFFFFFFFEull, 0x7F800000ul},
+        {
+            "1.79769313486231560835325876058105298516207002341652166261661174625869"
+            "5532672923265745300992879465492467506314903358770175220871059269879629"
+            "0627760473556921329019091915239418047621712533496094635638726128664019"
+            "8029037799514183602981511756283727771403830521483963923935633133642802"
+            "1390916694579278744640752189441e+308"
+          , 0x7FEFFFFFFFFFFFFFull, 0x7F800000ul},
+        {
+            "1.79769313486231560835325876058105298516207002341652166261661174625869"
+            "5532672923265745300992879465492467506314903358770175220871059269879629"
+            "0627760473556921329019091915239418047621712533496094635638726128664019"
+            "8029037799514183602981511756283727771403830521483963923935633133642802"
+            "1390916694579278744640752189439e+308"
+          , 0x7FEFFFFFFFFFFFFEull, 0x7F800000ul},
+        {
+            "2.10194769648722560638559437493487419692039291281477365763560242583468"
+            "6624028790902229957282543182373046875e-45"
+          , 0x36A8000000000000ull, 0x00000002ul},
+        {
+            "2.10194769648722560638559437493487419692039291281477365763560242583468"
+            "66240287909022299572825431823730468751e-45"
+          , 0x36A8000000000000ull, 0x00000002ul},
+        {
+            "2.10194769648722560638559437493487419692039291281477365763560242583468"
+            "66240287909022299572825431823730468749e-45"
+          , 0x36A8000000000000ull, 0x00000001ul},
+        {
+            "1.17549442088721072420959008340872484231447212078518461533454029413183"
+            "14539442813071445925743319094181060791015625e-38"
+          , 0x3810000010000000ull, 0x00800000ul},
+        {
+            "1.17549442088721072420959008340872484231447212078518461533454029413183"
+            "145394428130714459257433190941810607910156251e-38"
+          , 0x3810000010000000ull, 0x00800001ul},
+        {
+            "1.17549442088721072420959008340872484231447212078518461533454029413183"
+            "145394428130714459257433190941810607910156249e-38"
+          , 0x3810000010000000ull, 0x00800000ul},
+        {"1.000000059604644775390625e+00", 0x3FF0000010000000ull, 0x3F800000ul},
+        {"1.0000000596046447753906251e+00", 0x3FF0000010000000ull, 0x3F800001ul},
+        {"1.0000000596046447753906249e+00", 0x3FF0000010000000ull, 0x3F800000ul},
+        {"1.6777217e+07", 0x4170000010000000ull, 0x4B800000ul},
+        {"1.67772171e+07", 0x417000001199999Aull, 0x4B800001ul},
+        {"1.67772169e+07", 0x417000000E666666ull, 0x4B800000ul},
+        {"3.40282336497324057985868971510891282432e+38", 0x47EFFFFFD0000000ull, 0x7F7FFFFEul},
+        {"3.402823364973240579858689715108912824321e+38", 0x47EFFFFFD0000000ull, 0x7F7FFFFFul},
+        {"3.402823364973240579858689715108912824319e+38", 0x47EFFFFFD0000000ull, 0x7F7FFFFEul},
+    };
+
+    std::size_t const real_corpus_size = sizeof(real_corpus) / sizeof(real_corpus[0]);
+}
+
+#endif
@@ -23,6 +23,9 @@ main()
     using boost::spirit::x3::lexeme;
     using boost::spirit::x3::skip;
     using boost::spirit::x3::lit;
+    using boost::spirit::x3::ascii::blank;
+    namespace iso8859_1 = boost::spirit::x3::iso8859_1;
+    namespace standard = boost::spirit::x3::standard;
 
     {
         BOOST_TEST((test("a b c d", skip(space)[*char_])));
@@ -44,6 +47,37 @@ main()
         BOOST_TEST(!(test("a bcd", lexeme[lexeme[lit('a') >> 'b' >> skip[lit('c') >> 'd']]], space)));
     }
 
+    { // long runs, which are skipped 16 bytes at a time from a char const*
+        std::string s;
+        std::string const spaces = " \t\n\v\f\r      \t\t\n\n\r\n  ";
+        std::string const in = "a" + spaces + "b" + spaces + spaces + "c" + spaces;
+        BOOST_TEST((test_attr(in.c_str(), skip(space)[*char_], s)));
+        BOOST_TEST(s == "abc");
+
+        s.clear();
+        std::string const blanks = " \t              \t      ";
+        std::string const lines = "a" + blanks + "b" + blanks + "\n" + blanks + "c";
+        BOOST_TEST((test_attr(lines.c_str(), skip(blank)[*char_], s)));
+        BOOST_TEST(s == "ab\nc");
+
+        s.clear();
+        std::string const dashes = "--a-----------------------b--c-";
+        BOOST_TEST((test_attr(dashes.c_str(), skip(lit('-'))[*char_], s)));
+        BOOST_TEST(s == "abc");
+
+        // Other spaces of an encoding are left to the skipper
+        s.clear();
+        std::string const nbsp = "a        \xA0        \xA0\xA0                b";
+        BOOST_TEST((test_attr(nbsp.c_str(), skip(iso8859_1::space)[*standard::char_], s)));
+        BOOST_TEST(s == "ab");
+
+        // The same from iterators which go a character at a time
+        s.clear();
+        std::string::const_iterator first = in.begin();
+        BOOST_TEST((boost::spirit::x3::parse(first, in.end(), skip(space)[*char_], s)));
+        BOOST_TEST(s == "abc" && first == in.end());
+    }
+
     //~ { // lazy skip
         //~ using boost::phoenix::val;
 
@@ -0,0 +1,115 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/spirit/home/x3.hpp>
+#include <boost/cstdint.hpp>
+
+#include <iostream>
+#include <string>
+#include "test.hpp"
+
+namespace
+{
+    boost::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    boost::uint64_t next_random()
+    {
+        // xorshift64*
+        state ^= state >> 12;
+        state ^= state << 25;
+        state ^= state >> 27;
+        return state * 0x2545F4914F6CDD1Dull;
+    }
+
+    int failures = 0;
+
+    // char const* goes through memchr and SSE2, std::string::const_iterator
+    // a character at a time
+    template <typename Parser, typename Skipper>
+    bool same_as_one_at_a_time(std::string const& s, Parser const& p, Skipper const& skipper)
+    {
+        char const* first = s.c_str();
+        std::string::const_iterator i = s.begin();
+        std::string a, b;
+        bool const ra = boost::spirit::x3::phrase_parse(first, s.c_str() + s.size(), p, skipper, a);
+        bool const rb = boost::spirit::x3::phrase_parse(i, s.end(), p, skipper, b);
+        bool const ok = ra == rb && first - s.c_str() == i - s.begin() && a == b;
+        if (!ok && ++failures < 10)
+            std::cerr << s << std::endl;
+        return ok;
+    }
+}
+
+int
+main()
+{
+    using spirit_test::test;
+    using spirit_test::test_attr;
+    using boost::spirit::x3::space_comment;
+    using boost::spirit::x3::ascii::char_;
+    using boost::spirit::x3::ascii::space;
+    using boost::spirit::x3::ascii::blank;
+    using boost::spirit::x3::int_;
+    using boost::spirit::x3::lit;
+    using boost::spirit::x3::lexeme;
+
+    {
+        BOOST_TEST((test(" 1 , 2 ", int_ >> ',' >> int_, space_comment)));
+        BOOST_TEST((test("1// one\n,2", int_ >> ',' >> int_, space_comment)));
+        BOOST_TEST((test("1/* one */,/**/2/***/", int_ >> ',' >> int_, space_comment)));
+        BOOST_TEST((test("/* a\n * b **/ 1 // c", int_, space_comment)));
+        BOOST_TEST((test("1 //", int_, space_comment)));
+        BOOST_TEST((test("1 /* / * */ /* //*/", int_, space_comment)));
+        BOOST_TEST((test("\t\v\f\r\n 1 \n\n", int_, space_comment)));
+
+        // a / that doesn't start a comment is left for the grammar
+        BOOST_TEST((test("1 / 2", int_ >> '/' >> int_, space_comment)));
+        BOOST_TEST((test("1 /", int_ >> '/', space_comment)));
+        BOOST_TEST((test("1 /*/ 2", int_ >> '/' >> '*' >> '/' >> int_, space_comment)));
+        BOOST_TEST((!test("1 /* 2", int_ >> int_, space_comment)));
+        BOOST_TEST((test("1 /* 2", int_, space_comment, false)));
+
+        // comments separate tokens
+        std::string s;
+        BOOST_TEST((test_attr("ab/**/cd", *lexeme[+(char_ - '/')], s, space_comment)));
+        BOOST_TEST(s == "abcd");
+    }
+
+    { // as a parser
+        BOOST_TEST((test("  // a\n /* b */ ", space_comment)));
+        BOOST_TEST((!test("", space_comment)));
+        BOOST_TEST((!test("x", space_comment)));
+        BOOST_TEST((!test("/", space_comment)));
+        BOOST_TEST((!test("/*", space_comment)));
+        BOOST_TEST((test(" /*", space_comment, false)));
+    }
+
+    { // the same from a char const* and a character at a time
+        static char const* const pieces[] =
+        {
+            " ", "\t", "\n", "\r\n", "                    ", "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t",
+            "// line\n", "//\n", "//", "/* block */", "/***/", "/* * / ** */", "/*\n\n*/", "/*",
+            "/", "*", "a", "bc", "1"
+        };
+        std::size_t const n = sizeof(pieces) / sizeof(pieces[0]);
+
+        for (int i = 0; i != 20000; ++i)
+        {
+            std::string in;
+            for (std::size_t j = next_random() % 12; j != 0; --j)
+                in += pieces[next_random() % n];
+
+            BOOST_TEST((same_as_one_at_a_time(in, *char_, space_comment)));
+            BOOST_TEST((same_as_one_at_a_time(in, *char_, space)));
+            BOOST_TEST((same_as_one_at_a_time(in, *char_, blank)));
+            BOOST_TEST((same_as_one_at_a_time(in, *char_, lit(' '))));
+            BOOST_TEST((same_as_one_at_a_time(in, *(char_ - '/'), space_comment)));
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -200,6 +200,27 @@ main()
         BOOST_TEST(!sym.prefix_find(first, last) && first == str);
     }
 
+    { // frozen
+        symbols<char, int> sym;
+        sym.add("foo", 1)("fool", 2)("bar", 3);
+        int i = 0;
+        symbols<char, int> copy(sym);
+        sym.freeze();
+
+        BOOST_TEST((test_attr("fool", sym, i) && i == 2));
+        BOOST_TEST((test_attr("foo", copy, i) && i == 1));
+        BOOST_TEST((test("foolish", sym, false)));
+        BOOST_TEST((!test("ba", sym)));
+
+        sym.at("bar") = 4;
+        BOOST_TEST(sym.find("bar") && *sym.find("bar") == 4);
+        sym.add("baz", 5);
+        BOOST_TEST((test_attr("baz", copy, i) && i == 5));
+        sym.remove("foo");
+        BOOST_TEST(!sym.find("foo"));
+        BOOST_TEST(sym.find("fool") && *sym.find("fool") == 2);
+    }
+
     {
         // remove bug
 
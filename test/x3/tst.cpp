@@ -14,6 +14,29 @@
 
 namespace
 {
+    // A tst frozen again after every change, so that all lookups below
+    // go through the frozen layout
+    template <typename Char, typename T>
+    struct refrozen_tst : boost::spirit::x3::tst<Char, T>
+    {
+        typedef boost::spirit::x3::tst<Char, T> base_type;
+
+        template <typename Iterator>
+        T* add(Iterator first, Iterator last, T const& val)
+        {
+            T* r = base_type::add(first, last, val);
+            this->freeze();
+            return r;
+        }
+
+        template <typename Iterator>
+        void remove(Iterator first, Iterator last)
+        {
+            base_type::remove(first, last);
+            this->freeze();
+        }
+    };
+
     template <typename TST, typename Char>
     void add(TST& tst, Char const* s, int data)
     {
@@ -348,6 +371,82 @@ int main()
 
     tests<tst<char, int>, tst<wchar_t, int> >();
     tests<tst_map<char, int>, tst_map<wchar_t, int> >();
+    tests<
+        tst_map<char, int, boost::spirit::x3::detail::tst_hash_root>
+      , tst_map<wchar_t, int, boost::spirit::x3::detail::tst_hash_root> >();
+    tests<refrozen_tst<char, int>, refrozen_tst<wchar_t, int> >();
+
+    { // freeze and thaw
+        tst<char, int> lookup;
+        add(lookup, "apple", 1);
+        add(lookup, "applepie", 2);
+        lookup.freeze();
+        BOOST_TEST(lookup.is_frozen());
+
+        // an existing key leaves it frozen, a new one thaws it
+        add(lookup, "apple", 3);
+        BOOST_TEST(lookup.is_frozen());
+        docheck(lookup, "applexxx", true, 5, 1);
+        add(lookup, "apricot", 4);
+        BOOST_TEST(!lookup.is_frozen());
+        docheck(lookup, "apricots", true, 7, 4);
+
+        lookup.freeze();
+        tst<char, int> copy(lookup);
+        BOOST_TEST(copy.is_frozen());
+        docheck(copy, "applepie", true, 8, 2);
+        docheck(copy, "apricot", true, 7, 4);
+
+        // every byte value as a first character, past the linear scan
+        tst<char, int> bytes;
+        for (int i = 1; i != 256; ++i)
+        {
+            char const s[] = {char(i), 'x', 0};
+            add(bytes, s, i);
+        }
+        bytes.freeze();
+        for (int i = 1; i != 256; ++i)
+        {
+            char const s[] = {char(i), 'x', 'y', 0};
+            docheck(bytes, s, true, 2, i);
+        }
+        docheck(bytes, "a", false);
+
+        lookup.clear();
+        BOOST_TEST(!lookup.is_frozen());
+        docheck(lookup, "apple", false);
+    }
+
+    { // tst_map roots
+        tst_map<char, int> bytes;
+        for (int i = 1; i != 256; ++i)
+        {
+            char const s[] = {char(i), 0};
+            add(bytes, s, i);
+        }
+        add(bytes, "\xffy", 256);
+        for (int i = 1; i != 256; ++i)
+        {
+            char const s[] = {char(i), 'x', 0};
+            docheck(bytes, s, true, 1, i);
+        }
+        docheck(bytes, "\xffyz", true, 2, 256);
+
+        // a failed lookup leaves the input where it was
+        tst_map<wchar_t, int> wide;
+        add(wide, L"\x4e2d\x6587", 1);
+        add(wide, L"ab", 2);
+        wchar_t const* s = L"\x4e2dx";
+        wchar_t const* first = s;
+        BOOST_TEST(!wide.find(first, s + 2) && first == s);
+        docheck(wide, L"\x4e2d\x6587", true, 2, 1);
+        docheck(wide, L"abc", true, 2, 2);
+        docheck(wide, L"b", false);
+
+        int n = 0;
+        wide.for_each([&n](std::wstring const&, int) { ++n; });
+        BOOST_TEST(n == 2);
+    }
 
     return boost::report_errors();
 }
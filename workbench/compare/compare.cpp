@@ -0,0 +1,203 @@
+/*=============================================================================
+    Throughput, allocations and peak resident memory of the grammars in
+    compare.hpp for xf, x3 and qi on generated inputs.
+
+    compare [max_bytes [grammar]]
+
+    Sizes go up by 32x from 1 KB to max_bytes (default 32 MB; 1 GB inputs
+    want a machine with memory to spare for the attributes). Every case
+    runs in its own process so its peak RSS is its own.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "compare.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+    std::size_t allocations = 0;
+}
+
+void * operator new(std::size_t n)
+{
+    ++allocations;
+    if (void *p = std::malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete(void *p, std::size_t) noexcept {std::free(p);}
+
+namespace
+{
+    using generator = std::string (*)(std::size_t);
+
+    std::string word(std::mt19937 &rng, std::size_t max)
+    {
+        std::string s(rng() % max + 1, 'a');
+        // Starting with a letter
+        for (auto &c : s) c = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"[rng() % (&c == &s[0] ? 52 : 62)];
+        return s;
+    }
+
+    std::string calc(std::size_t size)
+    {
+        std::mt19937 rng(1);
+        std::string s = std::to_string(rng() % 999 + 1);
+        while (s.size() < size) (s += "+-*/"[rng() % 4]) += std::to_string(rng() % 999 + 1);
+        return s;
+    }
+
+    std::string uint_list(std::size_t size)
+    {
+        std::mt19937 rng(2);
+        std::string s = std::to_string(rng());
+        while (s.size() < size) (s += ',') += std::to_string(rng() >> (rng() % 32));
+        return s;
+    }
+
+    std::string csv(std::size_t size)
+    {
+        std::mt19937 rng(3);
+        std::string s;
+        while (s.size() < size)
+        {
+            for (int i = 0; i != 8; ++i) (s += i ? "," : "") += rng() % 8 ? word(rng, 10) : "";
+            s += '\n';
+        }
+        return s;
+    }
+
+    std::string json(std::size_t size)
+    {
+        std::mt19937 rng(4);
+        std::string s = "[";
+        while (s.size() < size)
+        {
+            s += s.size() == 1 ? "{" : ", {";
+            for (int i = 0, n = rng() % 3 + 3; i != n; ++i)
+            {
+                ((s += i ? ", \"" : "\"") += word(rng, 8)) += "\": ";
+                switch (rng() % 5)
+                {
+                    case 0: s += std::to_string(rng()); break;
+                    case 1: ((s += '"') += word(rng, 16)) += '"'; break;
+                    case 2: s += "true"; break;
+                    case 3: s += "false"; break;
+                    default: s += "null";
+                }
+            }
+            s += '}';
+        }
+        return s += ']';
+    }
+
+    std::string keywords(std::size_t size)
+    {
+        std::mt19937 rng(5);
+        std::string s;
+        while (s.size() < size) (s += compare::keyword_list[rng() % 16]) += ' ';
+        return s;
+    }
+
+    std::string identifiers(std::size_t size)
+    {
+        std::mt19937 rng(6);
+        std::string s;
+        while (s.size() < size) (s += word(rng, 16)) += ' ';
+        return s;
+    }
+
+    struct grammar
+    {
+        char const *name;
+        generator make;
+        compare::parse_function compare::library::*parse;
+    };
+
+    grammar const grammars[] = {
+        {"calc", calc, &compare::library::calc},
+        {"uint_list", uint_list, &compare::library::uint_list},
+        {"csv", csv, &compare::library::csv},
+        {"json", json, &compare::library::json},
+        {"keywords", keywords, &compare::library::keywords},
+        {"identifiers", identifiers, &compare::library::identifiers}
+    };
+
+    // Run in a child process: repeat the parse for about a second, then report
+    void run(grammar const &g, compare::library const &lib, std::size_t size)
+    {
+        std::string const input = g.make(size);
+        auto const parse = lib.*g.parse;
+        std::uint64_t checksum = 0;
+        std::size_t allocated = 0, repeats = 0;
+        double elapsed = 0;
+        try
+        {
+            std::size_t const before = allocations;
+            util::high_resolution_timer time;
+            checksum = parse(input);
+            elapsed = time.elapsed();
+            allocated = allocations - before;
+            for (repeats = 1; elapsed < 1; ++repeats)
+            {
+                time.restart();
+                parse(input);
+                elapsed += time.elapsed();
+            }
+        }
+        catch (std::exception const &e)
+        {
+            std::cout << g.name << ' ' << lib.name << ' ' << input.size() << ": " << e.what() << std::endl;
+            return;
+        }
+        rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        std::cout << g.name << std::string(12 - std::strlen(g.name), ' ') << lib.name << ' '
+                  << std::string(10 - std::to_string(input.size()).size(), ' ') << input.size() << " [B] "
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s] "
+                  << allocated << " [allocations] "
+                  << usage.ru_maxrss << " [KB peak RSS] "
+                  << "{checksum: " << checksum << "}" << std::endl;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : std::size_t(1) << 25;
+    char const *only = argc > 2 ? argv[2] : nullptr;
+
+    compare::library const libraries[] = {compare::xf_library(), compare::x3_library(), compare::qi_library()};
+
+    for (std::size_t size = 1 << 10; size <= max_size; size *= 32)
+    {
+        for (auto const &g : grammars)
+        {
+            if (only && std::strcmp(only, g.name)) continue;
+            for (auto const &lib : libraries)
+            {
+                std::cout << std::flush;
+                pid_t const pid = fork();
+                if (pid == 0)
+                {
+                    run(g, lib, size);
+                    std::cout << std::flush;
+                    _exit(0);
+                }
+                int status;
+                waitpid(pid, &status, 0);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,38 @@
+/*=============================================================================
+    The same grammars in xf, x3 and qi. Each parse function returns a
+    checksum of what it parsed, which has to agree between libraries,
+    and throws std::runtime_error when the input doesn't match.
+=============================================================================*/
+#if !defined(BOOST_SPIRIT_WORKBENCH_COMPARE_HPP)
+#define BOOST_SPIRIT_WORKBENCH_COMPARE_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace compare
+{
+    using parse_function = std::uint64_t (*)(std::string const &);
+
+    struct library
+    {
+        char const *name;
+        parse_function calc;        // uint (('+' | '-' | '*' | '/') uint)*, folded left to right
+        parse_function uint_list;   // uint % ',', summed
+        parse_function csv;         // *((*(char_ - ',' - '\n') % ',') >> '\n'), fields plus their lengths
+        parse_function json;        // '[' object % ',' ']' of flat objects, pairs plus numbers
+        parse_function keywords;    // *(keyword | ...), counted
+        parse_function identifiers; // *lexeme[alpha >> *alnum], their lengths
+    };
+
+    library xf_library();
+    library x3_library();
+    library qi_library();
+
+    // Keywords in the order they are tried, so "double" comes before "do"
+    char const * const keyword_list[] = {
+        "break", "case", "char", "const", "continue", "default", "double", "do",
+        "else", "enum", "float", "for", "goto", "if", "int", "return"
+    };
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*=============================================================================
+    qi versions of the compared grammars, with semantic actions in place
+    of attributes
+=============================================================================*/
+#include "compare.hpp"
+#include <boost/spirit/include/qi.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <stdexcept>
+
+namespace qi = boost::spirit::qi;
+
+namespace
+{
+    using range = boost::iterator_range<std::string::const_iterator>;
+
+    template <class Parser>
+    void parse(std::string const &in, Parser const &p)
+    {
+        auto b = in.begin();
+        if (!qi::parse(b, in.end(), p) || b != in.end()) throw std::runtime_error("qi parsing failed");
+    }
+
+    template <class Parser>
+    void phrase_parse(std::string const &in, Parser const &p)
+    {
+        auto b = in.begin();
+        if (!qi::phrase_parse(b, in.end(), p, qi::lit(' ')) || b != in.end()) throw std::runtime_error("qi parsing failed");
+    }
+
+    std::uint64_t calc(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto set = [&](unsigned long long t) {n = t;};
+        auto add = [&](unsigned long long t) {n += t;};
+        auto sub = [&](unsigned long long t) {n -= t;};
+        auto mul = [&](unsigned long long t) {n *= t;};
+        auto div = [&](unsigned long long t) {n /= t;};
+        auto const &u = qi::ulong_long;
+        parse(in, u[set] >> *(('+' >> u[add]) | ('-' >> u[sub]) | ('*' >> u[mul]) | ('/' >> u[div])));
+        return n;
+    }
+
+    std::uint64_t uint_list(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        parse(in, qi::ulong_long[([&](unsigned long long t) {n += t;})] % ',');
+        return n;
+    }
+
+    std::uint64_t csv(std::string const &in)
+    {
+        // Fields are only counted once their row matches, since the last attempt at a row fails
+        std::uint64_t n = 0, row = 0;
+        auto const field = qi::copy(qi::raw[*(qi::char_ - ',' - '\n')][([&](range const &r) {row += 1 + r.size();})]);
+        auto const start = qi::copy(qi::eps[([&] {row = 0;})]);
+        parse(in, *qi::omit[start >> field % ',' >> '\n'][([&] {n += row;})]);
+        return n;
+    }
+
+    std::uint64_t json(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const string = qi::copy(qi::lexeme['"' >> *~qi::char_('"') >> '"']);
+        auto const value = qi::copy(qi::ulong_long[([&](unsigned long long t) {n += t;})]
+            | qi::omit[string] | qi::lit("true") | qi::lit("false") | qi::lit("null"));
+        auto const pair = qi::copy((qi::omit[string] >> ':' >> value)[([&] {++n;})]);
+        auto const object = qi::copy('{' >> pair % ',' >> '}');
+        phrase_parse(in, '[' >> object % ',' >> ']');
+        return n;
+    }
+
+    std::uint64_t keywords(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const keyword = qi::copy(qi::lit("break") | "case" | "char" | "const" | "continue" | "default" | "double" | "do"
+            | "else" | "enum" | "float" | "for" | "goto" | "if" | "int" | "return");
+        phrase_parse(in, *keyword[([&] {++n;})]);
+        return n;
+    }
+
+    std::uint64_t identifiers(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const identifier = qi::copy(qi::raw[qi::lexeme[qi::alpha >> *qi::alnum]]);
+        phrase_parse(in, *identifier[([&](range const &r) {n += r.size();})]);
+        return n;
+    }
+}
+
+compare::library compare::qi_library()
+{
+    return {"qi", calc, uint_list, csv, json, keywords, identifiers};
+}
@@ -0,0 +1,92 @@
+/*=============================================================================
+    x3 versions of the compared grammars, with semantic actions in place
+    of attributes
+=============================================================================*/
+#include "compare.hpp"
+#include <boost/spirit/home/x3.hpp>
+#include <stdexcept>
+
+namespace x3 = boost::spirit::x3;
+
+namespace
+{
+    template <class Parser>
+    void parse(std::string const &in, Parser const &p)
+    {
+        auto b = in.begin();
+        if (!x3::parse(b, in.end(), p) || b != in.end()) throw std::runtime_error("x3 parsing failed");
+    }
+
+    template <class Parser>
+    void phrase_parse(std::string const &in, Parser const &p)
+    {
+        auto b = in.begin();
+        if (!x3::phrase_parse(b, in.end(), p, x3::lit(' ')) || b != in.end()) throw std::runtime_error("x3 parsing failed");
+    }
+
+    std::uint64_t calc(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto set = [&](auto &ctx) {n = x3::_attr(ctx);};
+        auto add = [&](auto &ctx) {n += x3::_attr(ctx);};
+        auto sub = [&](auto &ctx) {n -= x3::_attr(ctx);};
+        auto mul = [&](auto &ctx) {n *= x3::_attr(ctx);};
+        auto div = [&](auto &ctx) {n /= x3::_attr(ctx);};
+        auto const u = x3::ulong_long;
+        parse(in, u[set] >> *(('+' >> u[add]) | ('-' >> u[sub]) | ('*' >> u[mul]) | ('/' >> u[div])));
+        return n;
+    }
+
+    std::uint64_t uint_list(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        parse(in, x3::ulong_long[([&](auto &ctx) {n += x3::_attr(ctx);})] % ',');
+        return n;
+    }
+
+    std::uint64_t csv(std::string const &in)
+    {
+        // Fields are only counted once their row matches, since the last attempt at a row fails
+        std::uint64_t n = 0, row = 0;
+        auto const field = x3::raw[*(x3::char_ - ',' - '\n')][([&](auto &ctx) {row += 1 + x3::_attr(ctx).size();})];
+        auto const start = x3::eps[([&](auto &) {row = 0;})];
+        parse(in, *x3::omit[start >> field % ',' >> '\n'][([&](auto &) {n += row;})]);
+        return n;
+    }
+
+    std::uint64_t json(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const string = x3::lexeme['"' >> *~x3::char_('"') >> '"'];
+        auto const value = x3::ulong_long[([&](auto &ctx) {n += x3::_attr(ctx);})]
+            | x3::omit[string] | x3::lit("true") | x3::lit("false") | x3::lit("null");
+        auto const pair = x3::omit[x3::omit[string] >> ':' >> value][([&](auto &) {++n;})];
+        auto const object = '{' >> pair % ',' >> '}';
+        phrase_parse(in, '[' >> object % ',' >> ']');
+        return n;
+    }
+
+    std::uint64_t keywords(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const keyword = x3::lit("break") | x3::lit("case") | x3::lit("char") | x3::lit("const")
+            | x3::lit("continue") | x3::lit("default") | x3::lit("double") | x3::lit("do")
+            | x3::lit("else") | x3::lit("enum") | x3::lit("float") | x3::lit("for")
+            | x3::lit("goto") | x3::lit("if") | x3::lit("int") | x3::lit("return");
+        phrase_parse(in, *keyword[([&](auto &) {++n;})]);
+        return n;
+    }
+
+    std::uint64_t identifiers(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        auto const identifier = x3::raw[x3::lexeme[x3::alpha >> *x3::alnum]];
+        phrase_parse(in, *identifier[([&](auto &ctx) {n += x3::_attr(ctx).size();})]);
+        return n;
+    }
+}
+
+compare::library compare::x3_library()
+{
+    return {"x3", calc, uint_list, csv, json, keywords, identifiers};
+}
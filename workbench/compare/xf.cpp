@@ -0,0 +1,111 @@
+/*=============================================================================
+    xf versions of the compared grammars, parsed in a single fused pass
+=============================================================================*/
+#include "compare.hpp"
+#include "xf.hpp"
+#include <stdexcept>
+
+namespace
+{
+    using namespace xf::literals;
+    using namespace boost::hana::literals;
+
+    // Letters and digits as std::isalnum gives them in the "C" locale, like x3::alnum and qi::alnum
+    struct alnum_t
+    {
+        bool operator()(char c) const {return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');}
+    };
+
+    // As parser_t::fused, but the whole input has to match
+    template <class Parser, class ...Masks>
+    auto parse_all(std::string const &in, Parser const &p, Masks const &...masks)
+    {
+        xf::arena memory;
+        xf::arena_scope scope(&memory);
+        auto w = xf::with_masks(xf::make_window(in), boost::hana::make_tuple(masks...));
+        auto r = xf::fused(p, w);
+        if (!r || w) throw std::runtime_error("xf parsing failed");
+        return std::move(*r);
+    }
+
+    std::uint64_t calc(std::string const &in)
+    {
+        auto const op = xf::any('+'_x, '-'_x, '*'_x, '/'_x);
+        auto const r = parse_all(in, xf::seq(xf::uint64_x, *xf::seq(op, xf::uint64_x)));
+        std::uint64_t n = r[0_c];
+        for (auto const &t : r[1_c])
+        {
+            switch (t[0_c].index())
+            {
+                case 0: n += t[1_c]; break;
+                case 1: n -= t[1_c]; break;
+                case 2: n *= t[1_c]; break;
+                default: n /= t[1_c];
+            }
+        }
+        return n;
+    }
+
+    std::uint64_t uint_list(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        parse_all(in, xf::uint64_x / ','_x % xf::each([&](std::uint64_t u) {n += u;}));
+        return n;
+    }
+
+    std::uint64_t csv(std::string const &in)
+    {
+        auto const field = xf::view(*(xf::print_x - ','_x));
+        auto const row = xf::seq(field, *xf::seq(','_x, field), '\n'_x);
+        std::uint64_t n = 0;
+        for (auto const &r : parse_all(in, *row))
+        {
+            n += 1 + r[0_c].size();
+            for (auto const &f : r[1_c]) n += 1 + f[1_c].size();
+        }
+        return n;
+    }
+
+    std::uint64_t json(std::string const &in)
+    {
+        auto const string = xf::lexeme(xf::seq('"'_x, xf::view(*(xf::print_x - '"'_x)), '"'_x));
+        auto const value = xf::any(xf::uint64_x, string, "true"_x, "false"_x, "null"_x);
+        auto const pair = xf::seq(string, ':'_x, value);
+        auto const object = xf::seq('{'_x, pair, *xf::seq(','_x, pair), '}'_x);
+        auto const array = xf::seq('['_x, object, *xf::seq(','_x, object), ']'_x);
+
+        std::uint64_t n = 0;
+        auto count = [&](auto const &p) {
+            ++n;
+            if (p[2_c].index() == 0) n += p[2_c][0_c];
+        };
+        auto const r = parse_all(in, array, ' '_x);
+        auto objects = r[2_c];
+        auto visit = [&](auto const &o) {
+            count(o[1_c]);
+            for (auto const &p : o[2_c]) count(p[1_c]);
+        };
+        visit(r[1_c]);
+        for (auto const &o : objects) visit(o[1_c]);
+        return n;
+    }
+
+    std::uint64_t keywords(std::string const &in)
+    {
+        auto const keyword = xf::any("break"_x, "case"_x, "char"_x, "const"_x, "continue"_x, "default"_x, "double"_x, "do"_x,
+                                     "else"_x, "enum"_x, "float"_x, "for"_x, "goto"_x, "if"_x, "int"_x, "return"_x);
+        return parse_all(in, *xf::omit(keyword), ' '_x).size();
+    }
+
+    std::uint64_t identifiers(std::string const &in)
+    {
+        std::uint64_t n = 0;
+        for (auto const &v : parse_all(in, *xf::view(xf::alpha_x, *xf::char_predicate<alnum_t>()), ' '_x)) n += v.size();
+        return n;
+    }
+}
+
+compare::library compare::xf_library()
+{
+    return {"xf", calc, uint_list, csv, json, keywords, identifiers};
+}
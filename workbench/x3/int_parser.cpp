@@ -0,0 +1,102 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <cstdlib>
+#include <boost/spirit/home/x3.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Generate a random number string with N digits
+    std::string
+    gen_int(int digits)
+    {
+        std::string result;
+        if (rand()%2)                       // Prepend a '-'
+            result += '-';
+        result += '1' + (rand()%9);         // The first digit cannot be '0'
+
+        for (int i = 1; i < digits; ++i)    // Generate the remaining digits
+            result += '0' + (rand()%10);
+        return result;
+    }
+
+    int const count = 18;
+    std::string numbers[count];
+    char const* first[count];
+    char const* last[count];
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct strtoll_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < count; ++i)
+                this->val += strtoll(first[i], 0, 10);
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // char const* input, eight digits at a time
+    struct x3_pointer_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                long long n = 0;
+                char const* f = first[i];
+                x3::parse(f, last[i], x3::long_long, n);
+                this->val += n;
+            }
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // std::string iterators, a character at a time
+    struct x3_iterator_test : test::base
+    {
+        void benchmark()
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                long long n = 0;
+                std::string::const_iterator f = numbers[i].begin(), l = numbers[i].end();
+                x3::parse(f, l, x3::long_long, n);
+                this->val += n;
+            }
+        }
+    };
+}
+
+int main()
+{
+    srand(42);
+
+    // Random integers with 1 .. 18 digits
+    for (int i = 0; i < count; ++i)
+    {
+        numbers[i] = gen_int(i+1);
+        first[i] = numbers[i].c_str();
+        last[i] = first[i] + numbers[i].size();
+    }
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10000000,     // This is the maximum repetitions to execute
+        (strtoll_test)
+        (x3_pointer_test)
+        (x3_iterator_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,97 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <cstdlib>
+#include <boost/spirit/home/x3.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A config-like list of numbers: indented, with blank lines and
+    // comments between them
+    std::string text;
+    std::string commented;
+
+    auto const numbers = *(x3::int_ >> ',');
+
+    // The skipper one would write by hand
+    auto const comment_rule = x3::ascii::space
+        | "//" >> *(x3::ascii::char_ - x3::eol) >> x3::eol
+        | "/*" >> *(x3::ascii::char_ - "*/") >> "*/";
+
+    template <typename Iterator, typename Skipper>
+    int parse_numbers(Iterator first, Iterator last, Skipper const& skipper)
+    {
+        int n = 0;
+        x3::phrase_parse(first, last, numbers, skipper);
+        for (; first != last; ++first)
+            ++n; // not reached when the whole text parses
+        return n + 1;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct space_pointer_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_numbers(text.c_str(), text.c_str() + text.size(), x3::ascii::space);
+        }
+    };
+
+    struct space_iterator_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_numbers(text.begin(), text.end(), x3::ascii::space);
+        }
+    };
+
+    struct comment_rule_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_numbers(commented.c_str(), commented.c_str() + commented.size(), comment_rule);
+        }
+    };
+
+    struct space_comment_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += parse_numbers(commented.c_str(), commented.c_str() + commented.size(), x3::space_comment);
+        }
+    };
+}
+
+int main()
+{
+    srand(42);
+    for (int i = 0; i != 200; ++i)
+    {
+        std::string const indent(4 * (1 + rand() % 4), ' ');
+        std::string const number = std::to_string(rand() % 100000);
+        text += indent + number + ",\n\n";
+        commented += indent + "// the value of entry " + std::to_string(i) + "\n";
+        commented += indent + number + ", /* " + std::string(rand() % 40, '-') + " */\n\n";
+    }
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        10000,     // This is the maximum repetitions to execute
+        (space_pointer_test)
+        (space_iterator_test)
+        (comment_rule_test)
+        (space_comment_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
@@ -0,0 +1,66 @@
+/*=============================================================================
+    Lookups in a large x3::symbols table before and after freeze(): random
+    words of 4 to 12 letters, looked up in a shuffled order.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include <boost/spirit/home/x3.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    long live_code = 0;
+    int const repeats = 5;
+
+    template <class F>
+    void report(std::string const &label, std::size_t lookups, F const &f)
+    {
+        util::high_resolution_timer time;
+        long sum = 0;
+        for (int r = 0; r != repeats; ++r) sum = f();
+        double const elapsed = time.elapsed();
+        live_code += sum;
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * lookups / elapsed / 1e6 << " [M lookups/s] " << sum << " [checksum]" << std::endl;
+    }
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+    std::size_t const n = 1 << 20;
+
+    x3::symbols<char, int> sym;
+    std::vector<std::string> words;
+    while (words.size() != n)
+    {
+        std::string w(4 + gen() % 9, ' ');
+        for (auto &c : w) c = char('a' + gen() % 26);
+        sym.add(w, int(words.size()));
+        words.push_back(std::move(w));
+    }
+    std::shuffle(words.begin(), words.end(), gen);
+
+    auto const lookup = [&] {
+        long sum = 0;
+        for (auto const &w : words)
+        {
+            auto first = w.begin();
+            if (int const *v = sym.prefix_find(first, w.end())) sum += *v;
+        }
+        return sum;
+    };
+
+    report("tst", n, lookup);
+    util::high_resolution_timer time;
+    sym.freeze();
+    std::cout << "freeze: " << time.elapsed() << " [s]" << std::endl;
+    report("frozen", n, lookup);
+    return live_code == 0;
+}
@@ -0,0 +1,121 @@
+/*=============================================================================
+    Copyright (c) 2001-2014 Joel de Guzman
+
+    Distributed under the Boost Software License, Version 1.0. (See accompanying
+    file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+==============================================================================*/
+#include "../measure.hpp"
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <boost/spirit/home/x3/string/tst.hpp>
+#include <boost/spirit/home/x3/string/tst_map.hpp>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+
+    char const* keywords[] =
+    {
+        "alignas", "alignof", "asm", "auto", "bool", "break", "case", "catch",
+        "char", "class", "const", "constexpr", "const_cast", "continue",
+        "decltype", "default", "delete", "do", "double", "dynamic_cast",
+        "else", "enum", "explicit", "export", "extern", "false", "float",
+        "for", "friend", "goto", "if", "inline", "int", "long", "mutable",
+        "namespace", "new", "noexcept", "nullptr", "operator", "private",
+        "protected", "public", "register", "reinterpret_cast", "return",
+        "short", "signed", "sizeof", "static", "static_assert",
+        "static_cast", "struct", "switch", "template", "this", "throw",
+        "true", "try", "typedef", "typeid", "typename", "union", "unsigned",
+        "using", "virtual", "void", "volatile", "while"
+    };
+
+    std::size_t const number_of_keywords = sizeof(keywords) / sizeof(keywords[0]);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Source-like tokens: mostly keywords, with identifiers and punctuation
+    // that fail on the first character or part way into a keyword
+    std::vector<std::string> tokens;
+
+    x3::tst<char, int> tst_lookup;
+    x3::tst_map<char, int, x3::detail::tst_hash_root> hash_lookup;
+    x3::tst_map<char, int> slot_lookup;
+
+    template <typename Lookup>
+    void fill(Lookup& lookup)
+    {
+        for (std::size_t i = 0; i != number_of_keywords; ++i)
+        {
+            std::string const s = keywords[i];
+            lookup.add(s.begin(), s.end(), int(i + 1));
+        }
+    }
+
+    template <typename Lookup>
+    int lookup_all(Lookup const& lookup)
+    {
+        int val = 0;
+        for (auto const& t : tokens)
+        {
+            std::string::const_iterator first = t.begin();
+            if (int const* p = lookup.find(first, t.end()))
+                val += *p;
+        }
+        return val;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct tst_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(tst_lookup);
+        }
+    };
+
+    struct tst_map_hash_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(hash_lookup);
+        }
+    };
+
+    struct tst_map_slot_test : test::base
+    {
+        void benchmark()
+        {
+            this->val += lookup_all(slot_lookup);
+        }
+    };
+}
+
+int main()
+{
+    char const* others[] = {"x", "i", "count", "value", "(", ")", ";", "{", "}", "=", "size_t", "std"};
+
+    srand(42);
+    for (int i = 0; i != 64; ++i)
+    {
+        if (rand() % 3)
+            tokens.push_back(keywords[rand() % number_of_keywords]);
+        else
+            tokens.push_back(others[rand() % (sizeof(others) / sizeof(others[0]))]);
+    }
+
+    fill(tst_lookup);
+    fill(hash_lookup);
+    fill(slot_lookup);
+
+    BOOST_SPIRIT_TEST_BENCHMARK(
+        100000,     // This is the maximum repetitions to execute
+        (tst_test)
+        (tst_map_hash_test)
+        (tst_map_slot_test)
+    )
+
+    // This is ultimately responsible for preventing all the test code
+    // from being optimized away.  Change this to return 0 and you
+    // unplug the whole test's life support system.
+    return test::live_code != 0;
+}
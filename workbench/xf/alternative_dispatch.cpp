@@ -0,0 +1,140 @@
+/*=============================================================================
+    Compare trying every branch of an xf::alternative in order against
+    skipping the branches whose first characters rule them out.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Statements of a small language, each its own rule
+namespace statements
+{
+    using namespace xf::literals;
+
+    XF_DECLARE(if_statement);
+    XF_DECLARE(while_statement);
+    XF_DECLARE(return_statement);
+    XF_DECLARE(goto_statement);
+    XF_DECLARE(block);
+    XF_DECLARE(call);
+    XF_DECLARE(assignment);
+
+    XF_DEFINE(if_statement) = xf::seq("if"_x, '(', xf::size_x, ')');
+    XF_DEFINE(while_statement) = xf::seq("while"_x, '(', xf::size_x, ')');
+    XF_DEFINE(return_statement) = xf::seq("return"_x, xf::size_x);
+    XF_DEFINE(goto_statement) = xf::seq("goto"_x, '_', xf::size_x);
+    XF_DEFINE(block) = xf::seq('{', xf::size_x, '}');
+    XF_DEFINE(call) = xf::seq('_', xf::size_x, "()"_x);
+    XF_DEFINE(assignment) = xf::seq('$', xf::size_x, '=', xf::size_x);
+}
+
+namespace
+{
+    using namespace xf::literals;
+
+    // Same answer as hana::equal, but hides the exact comparison from the alternative
+    struct opaque_equal
+    {
+        template <class T, class U>
+        bool operator()(T t, U u) const {return t == u;}
+    };
+
+    char const *const words[] = {
+        "alignas", "alignof", "and", "asm", "auto", "bitand", "bitor", "bool", "break", "case",
+        "catch", "char", "class", "compl", "const", "constexpr", "continue", "decltype", "default", "delete",
+        "do", "double", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+        "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept",
+        "not", "nullptr", "operator", "or", "private", "protected", "public", "register", "return", "short",
+        "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "typedef"
+    };
+
+    auto const keywords = xf::any(
+        "alignas", "alignof", "and", "asm", "auto", "bitand", "bitor", "bool", "break", "case",
+        "catch", "char", "class", "compl", "const", "constexpr", "continue", "decltype", "default", "delete",
+        "do", "double", "else", "enum", "explicit", "export", "extern", "false", "float", "for",
+        "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept",
+        "not", "nullptr", "operator", "or", "private", "protected", "public", "register", "return", "short",
+        "signed", "sizeof", "static", "struct", "switch", "template", "this", "throw", "true", "typedef"
+    );
+
+    // Shaped like the factor rule of a calculator, without the recursion
+    auto const factor = xf::any(
+        xf::size_x,
+        xf::seq('(', xf::size_x, ')'),
+        xf::seq('-', xf::size_x),
+        xf::seq('+', xf::size_x)
+    );
+
+    // Mostly rules, whose first sets come from their bodies
+    auto const statement = xf::any(
+        statements::if_statement, statements::while_statement, statements::return_statement, statements::goto_statement,
+        statements::block, statements::call, statements::assignment, ';'
+    );
+
+    int live_code = 0;
+    int const repeats = 20;
+
+    template <class Parser, class Compare>
+    void report(char const *name, Parser const &p, std::vector<std::string> const &input, Compare const &cmp)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r)
+            for (auto const &s : input)
+            {
+                auto w = xf::make_window(s, cmp);
+                auto c = xf::check(xf::check_c, p, w);
+                live_code += c ? int(c->index()) : -1;
+            }
+        double const elapsed = time.elapsed();
+        std::string const label = name;
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << elapsed * 1e9 / (repeats * input.size()) << " [ns/check]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 16;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::vector<std::string> names, factors, lines;
+    for (std::size_t k = 0; k != input_size; ++k)
+    {
+        names.emplace_back(words[rand() % 60]);
+        std::string const n = std::to_string(rand());
+        switch (rand() % 4)
+        {
+            case 0: factors.push_back(n); break;
+            case 1: factors.push_back("(" + n + ")"); break;
+            case 2: factors.push_back("-" + n); break;
+            default: factors.push_back("+" + n);
+        }
+        switch (rand() % 8)
+        {
+            case 0: lines.push_back("if(" + n + ")"); break;
+            case 1: lines.push_back("while(" + n + ")"); break;
+            case 2: lines.push_back("return" + n); break;
+            case 3: lines.push_back("goto_" + n); break;
+            case 4: lines.push_back("{" + n + "}"); break;
+            case 5: lines.push_back("_" + n + "()"); break;
+            case 6: lines.push_back("$" + n + "=" + n); break;
+            default: lines.push_back(";");
+        }
+    }
+
+    report("keywords_linear", keywords, names, opaque_equal());
+    report("keywords_table", keywords, names, xf::hana::equal);
+    report("factor_linear", factor, factors, opaque_equal());
+    report("factor_table", factor, factors, xf::hana::equal);
+    report("rules_linear", statement, lines, opaque_equal());
+    report("rules_table", statement, lines, xf::hana::equal);
+
+    // Keeps the checks from being optimized away
+    return live_code == 0;
+}
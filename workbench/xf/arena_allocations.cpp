@@ -0,0 +1,95 @@
+/*=============================================================================
+    Count the allocations made while checking a grammar whose alternatives
+    carry recursive check data, with and without a parse-scoped arena.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+    std::size_t allocations = 0;
+}
+
+void * operator new(std::size_t n)
+{
+    ++allocations;
+    if (void *p = std::malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete(void *p, std::size_t) noexcept {std::free(p);}
+
+namespace
+{
+    using namespace xf::literals;
+
+    // Every alternative's check data is recursive_wrap'd
+    auto const term = xf::any(
+        xf::size_x,
+        xf::seq('(', xf::size_x, ')'),
+        xf::seq('-', xf::size_x)
+    );
+    auto const grammar = *xf::seq(term, xf::any('+'_x, '*'_x));
+
+    int live_code = 0;
+
+    template <class F>
+    void report(char const *name, std::string const &input, F const &f)
+    {
+        std::size_t const before = allocations;
+        util::high_resolution_timer time;
+        live_code += f();
+        double const elapsed = time.elapsed();
+        std::string const label = name;
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << allocations - before << " [allocations], "
+                  << input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 20;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::string input;
+    while (input.size() < input_size)
+    {
+        std::string const n = std::to_string(rand() % 1000);
+        switch (rand() % 3)
+        {
+            case 0: input += n; break;
+            case 1: input += "(" + n + ")"; break;
+            default: input += "-" + n;
+        }
+        input += rand() % 2 ? '+' : '*';
+    }
+
+    // The behaviour without an arena: one heap allocation per alternative node
+    report("heap", input, [&] {
+        auto w = xf::make_window(input);
+        auto data = xf::check(xf::check_c, grammar, w);
+        return int(xf::parse(xf::parse_c, grammar, std::move(data)).size());
+    });
+
+    // What parser_t does: check data comes from an arena released at the end of the parse
+    report("arena", input, [&] {
+        xf::arena memory;
+        auto w = xf::make_window(input);
+        auto data = [&] {xf::arena_scope scope(&memory); return xf::check(xf::check_c, grammar, w);}();
+        return int(xf::parse(xf::parse_c, grammar, std::move(data)).size());
+    });
+
+    report("parser", input, [&] {return int(xf::parser(grammar)(input).size());});
+
+    // Keeps the parses from being optimized away
+    return live_code == 0;
+}
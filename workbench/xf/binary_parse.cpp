@@ -0,0 +1,71 @@
+/*=============================================================================
+    Throughput of xf binary parsers against a hand written loop of loads on
+    fixed width records of a little-endian dword, a big-endian word and a
+    little-endian double.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace
+{
+    using namespace boost::hana::literals;
+
+    double live_code = 0;
+    int const repeats = 10;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        double sum = 0;
+        for (int r = 0; r != repeats; ++r) sum = f();
+        double const elapsed = time.elapsed();
+        live_code += sum;
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s] " << sum << " [checksum]" << std::endl;
+    }
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+    std::string input;
+    while (input.size() < (1 << 24))
+    {
+        auto const u = gen();
+        double const d = double(u % 1000) / 8;
+        char buf[14];
+        std::memcpy(buf, &u, 4);
+        buf[4] = char(u >> 40);
+        buf[5] = char(u >> 32);
+        std::memcpy(buf + 6, &d, 8);
+        input.append(buf, 14);
+    }
+
+    report("xf", input, [&] {
+        double sum = 0;
+        auto const record = xf::seq(xf::little_dword_x, xf::big_word_x, xf::little_bin_double_x);
+        xf::parser(*record % xf::each([&](auto const &t) {sum += t[0_c] % 7 + t[1_c] % 5 + t[2_c];}))(input);
+        return sum;
+    });
+
+    report("loads", input, [&] {
+        double sum = 0;
+        for (char const *p = input.data(), *e = p + input.size(); e - p >= 14; p += 14)
+        {
+            std::uint32_t u;
+            double d;
+            std::memcpy(&u, p, 4);
+            std::memcpy(&d, p + 6, 8);
+            sum += u % 7 + (std::uint16_t(std::uint8_t(p[4])) << 8 | std::uint8_t(p[5])) % 5 + d;
+        }
+        return sum;
+    });
+
+    return live_code == 0;
+}
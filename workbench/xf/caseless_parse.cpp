@@ -0,0 +1,74 @@
+/*=============================================================================
+    Throughput of caseless matching of HTTP header names: xf::caseless
+    literals, plain literals under a caseless_compare window, and plain
+    literals under a comparison calling to_lower on every char as
+    caseless_compare used to.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace
+{
+    using namespace xf::literals;
+
+    std::size_t live_code = 0;
+    int const repeats = 10;
+
+    struct locale_compare
+    {
+        template <class T, class U>
+        bool operator()(T t, U u) const {return xf::to_lower(t) == xf::to_lower(u);}
+    };
+
+    char const *const names[] = {"Content-Length", "Content-Type", "Transfer-Encoding", "Accept-Encoding",
+                                 "Connection", "User-Agent", "Cache-Control", "If-Modified-Since"};
+
+    auto const folded = xf::any(xf::caseless("content-length"), xf::caseless("content-type"),
+        xf::caseless("transfer-encoding"), xf::caseless("accept-encoding"), xf::caseless("connection"),
+        xf::caseless("user-agent"), xf::caseless("cache-control"), xf::caseless("if-modified-since")) / '\n'_x;
+
+    auto const plain = xf::any("content-length"_x, "content-type"_x, "transfer-encoding"_x, "accept-encoding"_x,
+        "connection"_x, "user-agent"_x, "cache-control"_x, "if-modified-since"_x) / '\n'_x;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    template <class Compare>
+    std::size_t count(std::string const &input, Compare c)
+    {
+        auto w = xf::make_window(input, c);
+        auto data = xf::check(xf::check_c, plain, w);
+        return xf::valid(plain, data) && !w ? 1 : 0;
+    }
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<std::size_t> pick(0, 7);
+    std::bernoulli_distribution upper(0.5);
+    std::string input;
+    while (input.size() < (1 << 22))
+    {
+        for (char const *c = names[pick(gen)]; *c; ++c) input += upper(gen) ? *c : xf::ascii_lower(*c);
+        input += '\n';
+    }
+    input.pop_back();
+
+    report("caseless", input, [&] {return xf::parser(folded).match(input) ? 1 : 0;});
+    report("caseless_compare", input, [&] {return count(input, xf::caseless_compare());});
+    report("to_lower", input, [&] {return count(input, locale_compare());});
+
+    return live_code == 0;
+}
@@ -0,0 +1,90 @@
+/*=============================================================================
+    Compare xf::parser_t's two-phase check+parse with its fused single pass:
+    time and the bytes allocated, including the intermediate check data.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace
+{
+    std::size_t allocated = 0;
+}
+
+void * operator new(std::size_t n)
+{
+    allocated += n;
+    if (void *p = std::malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete(void *p, std::size_t) noexcept {std::free(p);}
+
+namespace
+{
+    using namespace xf::literals;
+
+    int live_code = 0;
+    int const repeats = 5;
+
+    template <class F>
+    void report(char const *name, std::string const &input, F const &f)
+    {
+        std::size_t const before = allocated;
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::string const label = name;
+        std::cout << label << ": " << std::string(24 - label.size(), ' ')
+                  << (allocated - before) / repeats << " [bytes], "
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    // Bytes held by the check data alone, before parse consumes it
+    template <class P>
+    void check_data(char const *name, P const &p, std::string const &input)
+    {
+        std::size_t const before = allocated;
+        xf::arena memory;
+        auto w = xf::make_window(input);
+        auto data = [&] {xf::arena_scope scope(&memory); return xf::check(xf::check_c, p, w);}();
+        std::string const label = name;
+        std::cout << label << ": " << std::string(24 - label.size(), ' ')
+                  << allocated - before + sizeof(data) << " [bytes of check data]" << std::endl;
+        live_code += xf::valid(p, data);
+    }
+
+    template <class P>
+    void run(char const *name, P const &p, std::string const &input)
+    {
+        check_data((name + std::string("_check")).c_str(), p, input);
+        report((name + std::string("_two_phase")).c_str(), input, [&] {return int(xf::parser(p)(input).size());});
+        report((name + std::string("_fused")).c_str(), input, [&] {return int(xf::parser(p).fused(input).size());});
+    }
+
+    std::size_t const input_size = 1 << 20;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::string numbers, keywords;
+    char const *const words[] = {"if", "in", "else"};
+    while (numbers.size() < input_size)
+        numbers += std::to_string(rand() % 100000) + ",";
+    while (keywords.size() < input_size)
+        keywords += words[rand() % 3] + std::to_string(rand() % 1000) + ",";
+
+    run("uint_list", *xf::seq(xf::size_x, ','), numbers);
+    run("keyword_list", *xf::seq(xf::any("if", "in", "else"), xf::size_x, ','), keywords);
+
+    // Keeps the parses from being optimized away
+    return live_code == 0;
+}
@@ -0,0 +1,83 @@
+/*=============================================================================
+    Throughput of xf::keywords against an xf::any alternative of the same
+    84 C++ keywords, longest first so that the alternative matches the same
+    way, on space separated keywords.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace
+{
+    using namespace xf::literals;
+
+    std::size_t live_code = 0;
+    int const repeats = 10;
+
+    auto const table = xf::keywords(
+        "alignas", "alignof", "and", "and_eq", "asm", "auto",
+        "bitand", "bitor", "bool", "break", "case", "catch",
+        "char", "char16_t", "char32_t", "class", "compl", "const",
+        "constexpr", "const_cast", "continue", "decltype", "default", "delete",
+        "do", "double", "dynamic_cast", "else", "enum", "explicit",
+        "export", "extern", "false", "float", "for", "friend",
+        "goto", "if", "inline", "int", "long", "mutable",
+        "namespace", "new", "noexcept", "not", "not_eq", "nullptr",
+        "operator", "or", "or_eq", "private", "protected", "public",
+        "register", "reinterpret_cast", "return", "short", "signed", "sizeof",
+        "static", "static_assert", "static_cast", "struct", "switch", "template",
+        "this", "thread_local", "throw", "true", "try", "typedef",
+        "typeid", "typename", "union", "unsigned", "using", "virtual",
+        "void", "volatile", "wchar_t", "while", "xor", "xor_eq");
+
+    auto const alternative = xf::any(
+        "reinterpret_cast"_x, "static_assert"_x, "dynamic_cast"_x, "thread_local"_x, "static_cast"_x, "const_cast"_x,
+        "constexpr"_x, "namespace"_x, "protected"_x, "char16_t"_x, "char32_t"_x, "continue"_x,
+        "decltype"_x, "explicit"_x, "noexcept"_x, "operator"_x, "register"_x, "template"_x,
+        "typename"_x, "unsigned"_x, "volatile"_x, "alignas"_x, "alignof"_x, "default"_x,
+        "mutable"_x, "nullptr"_x, "private"_x, "typedef"_x, "virtual"_x, "wchar_t"_x,
+        "and_eq"_x, "bitand"_x, "delete"_x, "double"_x, "export"_x, "extern"_x,
+        "friend"_x, "inline"_x, "not_eq"_x, "public"_x, "return"_x, "signed"_x,
+        "sizeof"_x, "static"_x, "struct"_x, "switch"_x, "typeid"_x, "xor_eq"_x,
+        "bitor"_x, "break"_x, "catch"_x, "class"_x, "compl"_x, "const"_x,
+        "false"_x, "float"_x, "or_eq"_x, "short"_x, "throw"_x, "union"_x,
+        "using"_x, "while"_x, "auto"_x, "bool"_x, "case"_x, "char"_x,
+        "else"_x, "enum"_x, "goto"_x, "long"_x, "this"_x, "true"_x,
+        "void"_x, "and"_x, "asm"_x, "for"_x, "int"_x, "new"_x,
+        "not"_x, "try"_x, "xor"_x, "do"_x, "if"_x, "or"_x);
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 22;
+}
+
+int main()
+{
+    std::mt19937 rng(3);
+    std::string input;
+    while (input.size() < input_size) (input += table[rng() % table.size()]) += ' ';
+
+    report("keywords", input, [&] {
+        std::size_t n = 0;
+        xf::parser(*table % xf::each([&](std::size_t i) {n += i;}), ' '_x)(input);
+        return n;
+    });
+    report("any", input, [&] {
+        std::size_t n = 0;
+        xf::parser(*xf::omit(alternative) % xf::each([&](auto) {++n;}), ' '_x)(input);
+        return n;
+    });
+
+    return live_code == 0;
+}
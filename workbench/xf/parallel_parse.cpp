@@ -0,0 +1,49 @@
+/*=============================================================================
+    Throughput of parser_t::parallel against a plain parse of the same list
+    grammar, on newline separated records, for a rising number of threads.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+
+namespace
+{
+    using namespace xf::literals;
+
+    std::size_t live_code = 0;
+    int const repeats = 5;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f().size();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(24 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 25;
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+    std::uniform_int_distribution<unsigned> id(0, 1000000);
+    std::string input;
+    while (input.size() < input_size)
+        input += std::to_string(id(gen)) + ',' + std::to_string(id(gen)) + ',' + std::to_string(id(gen)) + '\n';
+    input.pop_back();
+
+    auto const lines = xf::seq(xf::uint_x, ','_x, xf::uint_x, ','_x, xf::uint_x) / '\n'_x;
+    report("sequential", input, [&] {return xf::parser(lines)(input);});
+    auto const cores = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned n = 1; n <= 2 * cores; n *= 2)
+        report("parallel_" + std::to_string(n), input, [&] {return xf::parser(lines).parallel(input, n);});
+
+    return live_code == 0;
+}
@@ -0,0 +1,102 @@
+/*=============================================================================
+    Throughput of xf::double_x against std::strtod, x3::double_ and
+    x3::exact_double_ on comma separated reals of a few typical shapes, with
+    the number of values each rounds differently from strtod.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+#include <boost/spirit/home/x3.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    namespace x3 = boost::spirit::x3;
+    using namespace xf::literals;
+
+    double live_code = 0;
+    int const repeats = 10;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, std::vector<double> const &expected, F const &f)
+    {
+        std::vector<double> out;
+        out.reserve(expected.size());
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r)
+        {
+            out.clear();
+            f(out);
+        }
+        double const elapsed = time.elapsed();
+        std::size_t wrong = out.size() != expected.size();
+        for (std::size_t i = 0; i != out.size() && i != expected.size(); ++i)
+            wrong += std::memcmp(&out[i], &expected[i], sizeof(double)) != 0;
+        live_code += out.empty() ? 0 : out.back();
+        std::cout << label << ": " << std::string(24 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s] "
+                  << wrong << " [misrounded]" << std::endl;
+    }
+
+    void run(std::string const &name, std::string const &input)
+    {
+        std::vector<double> expected;
+        for (char const *p = input.c_str(); *p; ++p) expected.push_back(std::strtod(p, const_cast<char **>(&p)));
+
+        report(name + "_xf", input, expected, [&](auto &out) {
+            xf::parser(xf::double_x / ','_x % xf::each([&](double d) {out.push_back(d);}))(input);
+        });
+        report(name + "_strtod", input, expected, [&](auto &out) {
+            for (char const *p = input.c_str(); *p; ++p) out.push_back(std::strtod(p, const_cast<char **>(&p)));
+        });
+        report(name + "_x3", input, expected, [&](auto &out) {
+            auto b = input.begin();
+            x3::parse(b, input.end(), x3::double_[([&](auto &ctx) {out.push_back(x3::_attr(ctx));})] % ',');
+        });
+        report(name + "_x3_exact", input, expected, [&](auto &out) {
+            auto b = input.begin();
+            x3::parse(b, input.end(), x3::exact_double_[([&](auto &ctx) {out.push_back(x3::_attr(ctx));})] % ',');
+        });
+    }
+
+    std::size_t const input_size = 1 << 22;
+}
+
+int main()
+{
+    std::mt19937_64 gen(42);
+    char buf[64];
+    auto make = [&](auto const &value) {
+        std::string s;
+        while (s.size() < input_size)
+        {
+            value(buf);
+            s += buf;
+            s += ',';
+        }
+        s.pop_back();
+        return s;
+    };
+
+    // Coordinates as in GeoJSON: shortest round trip of a double near +-180
+    std::uniform_real_distribution<double> coord(-180, 180);
+    run("coordinates", make([&](char *b) {std::snprintf(b, 64, "%.17g", coord(gen));}));
+    // Prices and measurements: a few decimals
+    std::uniform_int_distribution<int> cents(0, 10000000);
+    run("fixed", make([&](char *b) {std::snprintf(b, 64, "%d.%02d", cents(gen) / 100, cents(gen) % 100);}));
+    // Whole range, scientific notation
+    std::uniform_int_distribution<std::uint64_t> bits;
+    run("scientific", make([&](char *b) {
+        double d;
+        do {auto u = bits(gen); std::memcpy(&d, &u, sizeof(d));} while (!(d - d == 0));
+        std::snprintf(b, 64, "%.16e", d);
+    }));
+
+    return live_code == 0;
+}
@@ -0,0 +1,92 @@
+/*=============================================================================
+    Allocations and throughput when parsing many small messages, each on
+    its own, through an xf::session, and as one parse_many batch.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    std::size_t allocations = 0;
+}
+
+void * operator new(std::size_t n)
+{
+    ++allocations;
+    if (void *p = std::malloc(n)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept {std::free(p);}
+void operator delete(void *p, std::size_t) noexcept {std::free(p);}
+
+namespace
+{
+    using namespace xf::literals;
+
+    // A packet of ; terminated records of a tagged alternative each
+    auto const field = xf::any(xf::seq('#'_x, xf::size_x), xf::seq('-'_x, xf::size_x), xf::size_x);
+    auto const message = *xf::seq(field, ','_x, field, ';'_x);
+
+    std::size_t live_code = 0;
+
+    template <class F>
+    void report(std::string const &label, std::vector<std::string> const &inputs, std::size_t bytes, F const &f)
+    {
+        std::size_t const before = allocations;
+        util::high_resolution_timer time;
+        live_code += f();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << double(allocations - before) / inputs.size() << " [allocations/message], "
+                  << bytes / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+}
+
+int main()
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> n(0, 9999), kind(0, 2), records(1, 12);
+    auto value = [&] {
+        auto const k = kind(gen);
+        return (k == 0 ? "#" : k == 1 ? "-" : "") + std::to_string(n(gen));
+    };
+    std::vector<std::string> inputs(200000);
+    std::size_t bytes = 0;
+    for (auto &s : inputs)
+    {
+        for (int r = records(gen); r; --r) s += value() + "," + value() + ";";
+        bytes += s.size();
+    }
+
+    auto const p = xf::parser(message);
+    report("parser", inputs, bytes, [&] {
+        std::size_t total = 0;
+        for (auto const &s : inputs) total += p(s).size();
+        return total;
+    });
+
+    xf::session s;
+    report("session", inputs, bytes, [&] {
+        std::size_t total = 0;
+        for (auto const &i : inputs) total += p(i, s).size();
+        return total;
+    });
+    std::cout << "saved: " << std::string(20 - 5, ' ') << s.allocations_saved_per_parse() << " [allocations/message]" << std::endl;
+
+    xf::session batch;
+    report("parse_many", inputs, bytes, [&] {
+        std::size_t total = 0;
+        for (auto const &r : p.parse_many(inputs, batch)) total += r->size();
+        return total;
+    });
+
+    return live_code == 0;
+}
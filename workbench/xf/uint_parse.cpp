@@ -0,0 +1,63 @@
+/*=============================================================================
+    Throughput of xf::uint64_x on comma separated numbers, short and long,
+    with std::strtoull on the same input for reference.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    using namespace boost::hana::literals;
+
+    auto const numbers = *xf::seq(xf::uint64_x, ',');
+
+    unsigned long long live_code = 0;
+    int const repeats = 10;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    void run(char const *name, std::string const &input)
+    {
+        report(name + std::string("_xf"), input, [&] {
+            auto const v = xf::parser(numbers).fused(input);
+            return v.empty() ? 0 : v.back()[0_c];
+        });
+        report(name + std::string("_strtoull"), input, [&] {
+            unsigned long long n = 0;
+            for (char const *p = input.c_str(); *p; ++p) n += std::strtoull(p, const_cast<char **>(&p), 10);
+            return n;
+        });
+    }
+
+    std::size_t const input_size = 1 << 20;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::string short_numbers, long_numbers;
+    while (short_numbers.size() < input_size)
+        short_numbers += std::to_string(rand() % 100000) + ",";
+    while (long_numbers.size() < input_size)
+        long_numbers += std::to_string((unsigned long long)(rand()) * rand() * rand()) + ",";
+
+    run("short", short_numbers);
+    run("long", long_numbers);
+
+    // Keeps the parses from being optimized away
+    return live_code == 0;
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+    Compare the linear if-chain against the jump table in xf::variant
+    for variants with 2, 8, 32 and 128 alternatives.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf/support/variant.hpp"
+
+#include <boost/config.hpp>
+#include <boost/hana/for_each.hpp>
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <std::size_t N>
+    struct alt
+    {
+        int value;
+        explicit alt(int v) : value(v) {}
+    };
+
+    template <class Is> struct variant_of;
+    template <std::size_t ...Is>
+    struct variant_of<std::index_sequence<Is...>> {using type = xf::variant<false, alt<Is>...>;};
+
+    template <std::size_t N>
+    using variant_n = typename variant_of<std::make_index_sequence<N>>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Exposes the protected dispatch strategies
+    template <class V>
+    struct dispatch_access : V
+    {
+        template <class F>
+        static int linear(V &v, F const &f) {return V::fold(xf::hana::llong_c<0>, v.index(), typename V::at(), v, f);}
+
+        template <class F>
+        static int table(V &v, F const &f) {return V::jump(std::make_index_sequence<V::size>(), v.index(), typename V::at(), v, f);}
+
+        template <class F>
+        static int chosen(V &v, F const &f) {return V::dispatch(v.index(), typename V::at(), v, f);}
+    };
+
+    // Different out-of-line work per alternative so the branches can't be merged
+    template <std::size_t I>
+    BOOST_NOINLINE int work(int v) {return v % int(I + 3);}
+
+    struct get_value
+    {
+        template <class I, class T>
+        int operator()(I, T const &t) const {return work<I::value>(t.value);}
+    };
+
+    int live_code = 0;
+    std::size_t const pool_size = 1 << 20;
+    int const repeats = 10;
+
+    template <class F>
+    void report(char const *name, std::size_t n, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::string const label = name + ("_" + std::to_string(n));
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << elapsed * 1e9 / (repeats * pool_size) << " [ns/visit]" << std::endl;
+    }
+
+    template <std::size_t N>
+    void run()
+    {
+        using V = variant_n<N>;
+        using access = dispatch_access<V>;
+
+        // A shuffled pool of variants so the branch predictor can't learn the index
+        std::vector<V> pool;
+        pool.reserve(pool_size);
+        for (std::size_t k = 0; k != pool_size; ++k)
+        {
+            std::size_t const n = rand() % N;
+            xf::hana::for_each(xf::indices_c<N>, [&](auto i) {
+                if (std::size_t(i) == n) pool.emplace_back(i, int(k));
+            });
+        }
+
+        report("linear", N, [&] {int s = 0; for (auto &v : pool) s += access::linear(v, get_value()); return s;});
+        report("table", N, [&] {int s = 0; for (auto &v : pool) s += access::table(v, get_value()); return s;});
+        report("dispatch", N, [&] {int s = 0; for (auto &v : pool) s += access::chosen(v, get_value()); return s;});
+    }
+}
+
+int main()
+{
+    srand(time(0));
+
+    run<2>();
+    run<8>();
+    run<32>();
+    run<128>();
+
+    // Keeps the visits from being optimized away
+    return live_code == 0;
+}
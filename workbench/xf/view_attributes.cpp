@@ -0,0 +1,51 @@
+/*=============================================================================
+    Words parsed by xf::lexeme into std::vector<char> attributes against xf::view into
+    the input buffer and xf::omit.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    unsigned long long live_code = 0;
+    int const repeats = 10;
+
+    template <class F>
+    void report(std::string const &label, std::string const &input, F const &f)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += f();
+        double const elapsed = time.elapsed();
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 20;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::string input;
+    while (input.size() < input_size)
+        input += std::string(1 + rand() % 12, 'a' + rand() % 26) + " ";
+
+    report("vector", input, [&] {
+        return xf::parser(*xf::lexeme(+xf::alpha_x), xf::literal<char>(' ')).fused(input).size();
+    });
+    report("view", input, [&] {
+        return xf::parser(*xf::view(+xf::alpha_x), xf::literal<char>(' ')).fused(input).size();
+    });
+    report("omit", input, [&] {
+        return std::size_t(xf::parser(*xf::omit(+xf::alpha_x), xf::literal<char>(' ')).match(input));
+    });
+
+    // Keeps the parses from being optimized away
+    return live_code == 0;
+}
@@ -0,0 +1,56 @@
+/*=============================================================================
+    Parse a whitespace-heavy config with space_x as the skipper, comparing
+    the vectorized skip with the same class applied one char at a time.
+=============================================================================*/
+#include "../high_resolution_timer.hpp"
+#include "xf.hpp"
+
+#include <cctype>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    using namespace xf::literals;
+
+    // Same class as space_x but without its bulk skip
+    struct slow_space
+    {
+        bool operator()(char c) const {return std::isspace(static_cast<unsigned char>(c));}
+    };
+
+    auto const config = *xf::seq(xf::lexeme(+xf::alpha_x), '=', xf::size_x);
+
+    int live_code = 0;
+    int const repeats = 10;
+
+    template <class Mask>
+    void report(char const *name, std::string const &input, Mask const &mask)
+    {
+        util::high_resolution_timer time;
+        for (int r = 0; r != repeats; ++r) live_code += int(xf::parser(config, mask).fused(input).size());
+        double const elapsed = time.elapsed();
+        std::string const label = name;
+        std::cout << label << ": " << std::string(20 - label.size(), ' ')
+                  << repeats * input.size() / elapsed / 1e6 << " [MB/s]" << std::endl;
+    }
+
+    std::size_t const input_size = 1 << 20;
+}
+
+int main()
+{
+    srand(time(0));
+
+    std::string input;
+    while (input.size() < input_size)
+        input += std::string(4 * (rand() % 16), ' ') + "key\t=  " + std::to_string(rand()) + "\n\n";
+
+    report("per_char", input, xf::char_predicate<slow_space>());
+    report("vectorized", input, xf::space_x);
+
+    // Keeps the parses from being optimized away
+    return live_code == 0;
+}
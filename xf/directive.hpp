@@ -1,2 +1,5 @@
 #include "directive/lexeme.hpp"
 #include "directive/partial.hpp"
+#include "directive/view.hpp"
+#include "directive/memoize.hpp"
+#include "directive/each.hpp"
@@ -0,0 +1,131 @@
+#pragma once
+#include "../operator/list.hpp"
+#include "../operator/transform.hpp"
+
+namespace xf {
+
+/******************************************************************************************/
+
+// The element, separator and minimum count of each kind of repeat
+template <class Subject>
+constexpr auto repeat_parts(kleene<Subject> const &r) {return hana::make_tuple(r.subject(), hana::nothing, 0_c);}
+
+template <class Subject>
+constexpr auto repeat_parts(plus<Subject> const &r) {return hana::make_tuple(r.subject(), hana::nothing, 1_c);}
+
+template <class Subject, class Separator>
+constexpr auto repeat_parts(list<Subject, Separator> const &r) {return hana::make_tuple(r.subject(), r.separator(), 1_c);}
+
+/******************************************************************************************/
+
+// Hands each element of a repeat to f as it is parsed rather than collecting them
+// Checking only counts the elements, which are checked again one at a time while parsing,
+// so f is called only once the whole parse is known to be good and nothing grows with the input
+// Elements which commit can't be checked again, so each is parsed and handed to f as soon as it is checked
+template <class Repeat, class F>
+class each_t : parser_base {
+    using parts_type = decltype(repeat_parts(std::declval<Repeat const &>()));
+    parts_type parts;
+    F function;
+
+    static constexpr std::size_t minimum = std::decay_t<decltype(hana::at_c<2>(std::declval<parts_type>()))>::value;
+
+    constexpr auto const & subject() const {return parts[0_c];}
+
+    // The separator before an element after the first, if there is one
+    template <class Tag, class Window>
+    static bool separate(Tag, hana::optional<> const &, Window &) {return true;}
+
+    template <class Tag, class Separator, class Window>
+    static bool separate(Tag tag, Separator const &s, Window &w) {return valid(s, check(tag, s, w));}
+
+    template <class Tag, class Window>
+    bool next(Tag tag, Window &w, std::size_t n) const {
+        auto save = w;
+        if ((n == 0 || separate(tag, parts[1_c], w)) && valid(subject(), check(tag, subject(), w))) return true;
+        w = save;
+        return false;
+    }
+
+public:
+
+    constexpr each_t(Repeat const &r, F f) : parts(repeat_parts(r)), function(std::move(f)) {}
+
+    template <class Tag, class Window, int_if<is_check<Tag> && !has_commit<Repeat>::value> = 0>
+    auto operator()(Tag tag, Window &w) const {
+        repeat_span<Window> ret{w, 0};
+        while (next(tag, w, ret.count)) ++ret.count;
+        return ret;
+    }
+
+    // The data is just the number of elements
+    template <class Tag, class Window, int_if<is_check<Tag> && has_commit<Repeat>::value> = 0>
+    std::size_t operator()(Tag, Window &w) const {
+        std::size_t n = 0;
+        for (;; ++n) {
+            auto save = w;
+            if (n && !separate(check_c, parts[1_c], w)) break;
+            auto t = fused(subject(), w);
+            if (!t) {w = save; break;}
+            function(std::move(*t));
+        }
+        return n;
+    }
+
+    template <class Window>
+    bool operator()(valid_t, repeat_span<Window> const &data) const {return data.count >= minimum;}
+
+    bool operator()(valid_t, std::size_t n) const {return n >= minimum;}
+
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {
+        std::size_t n = 0;
+        while (next(check_c, w, n)) ++n;
+        return n >= minimum;
+    }
+
+    // No fused path: f must not see elements of a parse that is later abandoned
+
+    template <class Tag, class Window, int_if<is_parse<Tag>> = 0>
+    auto operator()(Tag tag, repeat_span<Window> data) const {
+        auto &w = *data.begin;
+        for (std::size_t i = 0; i != data.count; ++i) {
+            if (i) separate(check_c, parts[1_c], w);
+            function(parse(tag, subject(), check(check_c, subject(), w)));
+        }
+        return hana::nothing;
+    }
+
+    template <class Tag, int_if<is_parse<Tag>> = 0>
+    auto operator()(Tag, std::size_t) const {return hana::nothing;}
+
+    template <class Tag, int_if<is_first<Tag>> = 0>
+    constexpr first_set operator()(Tag tag) const {
+        auto const f = first(tag, subject());
+        return minimum ? f : f.with_nullable(true);
+    }
+};
+
+/******************************************************************************************/
+
+template <class F>
+struct each_gen {
+    F function;
+
+    template <class Repeat>
+    constexpr auto operator()(Repeat const &r) const {return each_t<Repeat, F>(r, function);}
+
+    template <class Repeat, int_if<is_expression<std::decay_t<Repeat>>> = 0>
+    friend constexpr auto operator%(Repeat const &r, each_gen const &e) {return e(r);}
+};
+
+template <class F>
+struct prevent_transform<each_gen<F>> : std::true_type {};
+
+// p % each(f) calls f with each attribute of the repeat p in turn and gives no attribute itself
+template <class F>
+constexpr auto each(F f) {return each_gen<F>{std::move(f)};}
+
+/******************************************************************************************/
+
+}
@@ -20,10 +20,19 @@ struct lexeme_t {
         template <class Data>
         constexpr auto operator()(valid_t, Data const &data) const {return valid(subject, data);}
 
+        template <class Window>
+        auto operator()(fused_t, Window &w) const {return w.no_skip([&](auto &w) {return fused(subject, w);});}
+
+        template <class Window>
+        bool operator()(recognize_t, Window &w) const {return w.no_skip([&](auto &w) {return recognize(subject, w);});}
+
         template <class T, class Data, int_if<is_parse<T>> = 0>
         constexpr auto operator()(T tag, Data data) const {
             return parse(tag, subject, std::move(data));
         }
+
+        template <class F, int_if<is_first<F>> = 0>
+        constexpr first_set operator()(F f) const {return first(f, subject);}
     };
 
     constexpr lexeme_t() {}
@@ -0,0 +1,110 @@
+#pragma once
+#include "../operator/transform.hpp"
+#include "../support/memo.hpp"
+
+#include <cstring>
+#include <memory>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Input positions have to be ordered to be looked up
+template <class I, class=void> struct is_memo_key_t : std::false_type {};
+template <class I> struct is_memo_key_t<I, void_t<decltype(std::declval<I const &>() < std::declval<I const &>())>> : std::true_type {};
+
+/******************************************************************************************/
+
+// Checks its subject once per input position within a memo_scope, copying the data out on later visits
+template <class Subject>
+class memoize_t : parser_base {
+    Subject subject;
+
+    template <class Data, class Window>
+    struct entry {
+        Data data;
+        Window after;
+    };
+
+    // Entries are keyed by the subject's bytes as well as the position. Copies of a memoized parser, like a
+    // prefix shared by several branches, share them, while parsers of the same type that differ don't
+    template <class I>
+    struct key {
+        I position;
+        unsigned char bytes[sizeof(Subject)];
+
+        friend bool operator<(key const &a, key const &b) {
+            if (a.position < b.position) return true;
+            if (b.position < a.position) return false;
+            return std::memcmp(a.bytes, b.bytes, sizeof(Subject)) < 0;
+        }
+    };
+
+    template <class I>
+    key<I> make_key(I position) const {
+        key<I> k{std::move(position), {}};
+        std::memcpy(k.bytes, std::addressof(subject), sizeof(Subject));
+        return k;
+    }
+
+    template <class Tag, class Window>
+    static void const * id() {
+        static char const c = 0;
+        return &c;
+    }
+
+    template <class Tag, class Window, int_if<is_memo_key_t<std::decay_t<decltype(std::declval<Window>().begin())>>::value> = 0>
+    auto memo_check(Tag tag, Window &w, int) const {
+        using E = entry<decltype(check(tag, subject, w)), Window>;
+        auto table = memo_table::current();
+        if (!table) return check(tag, subject, w);
+        auto const k = make_key(w.begin());
+        if (auto e = table->template find<E>(id<Tag, Window>(), k)) {
+            w = e->after;
+            return e->data;
+        }
+        auto data = check(tag, subject, w);
+        table->insert(id<Tag, Window>(), k, E{data, w});
+        return data;
+    }
+
+    template <class Tag, class Window>
+    auto memo_check(Tag tag, Window &w, long) const {return check(tag, subject, w);}
+
+public:
+
+    constexpr memoize_t(Subject s) : subject(std::move(s)) {}
+
+    template <class Tag, class Window, int_if<is_check<Tag>> = 0>
+    auto operator()(Tag tag, Window &w) const {return memo_check(tag, w, 0);}
+
+    template <class Data>
+    auto operator()(valid_t, Data const &d) const {return valid(subject, d);}
+
+    template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
+    decltype(auto) operator()(Tag tag, Data &&data) const {return parse(tag, subject, std::forward<Data>(data));}
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, subject);}
+};
+
+/******************************************************************************************/
+
+struct memoize_gen {
+    constexpr memoize_gen() {}
+
+    template <class Subject>
+    constexpr auto operator()(Subject &&s) const {return memoize_t<std::decay_t<decltype(expr(std::forward<Subject>(s)))>>(expr(std::forward<Subject>(s)));}
+
+    template <class Subject, int_if<is_expression<std::decay_t<Subject>>> = 0>
+    friend constexpr auto operator%(Subject &&s, memoize_gen m) {return m(std::forward<Subject>(s));}
+};
+
+template <>
+struct prevent_transform<memoize_gen> : std::true_type {};
+
+static constexpr auto memoize = memoize_gen();
+
+/******************************************************************************************/
+
+}
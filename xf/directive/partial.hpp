@@ -22,10 +22,24 @@ public:
     template <class Data>
     auto operator()(valid_t, Data const &d) const {return valid(subject, d);}
 
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {return recognize(subject, w);}
+
+    template <class Window>
+    auto operator()(fused_t, Window &w) const {
+        auto t = fused(subject, w);
+        optional_type<std::decay_t<decltype(no_void[apply(fused_c, subject, hana::capture, std::move(*t))(operation), no_void])>> ret;
+        if (t) ret.emplace(no_void[apply(fused_c, subject, hana::capture, std::move(*t))(operation), no_void]);
+        return ret;
+    }
+
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag tag, Data &&data) const {
         return no_void[apply(tag, subject, hana::capture, std::forward<Data>(data))(operation), no_void];
     }
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, subject);}
 };
 
 /******************************************************************************************/
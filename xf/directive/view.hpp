@@ -0,0 +1,119 @@
+#pragma once
+#include "../operator/sequence.hpp"
+#include <boost/range/iterator_range.hpp>
+#include <boost/utility/string_view.hpp>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Contiguous characters are viewed in place, anything else as an iterator range
+template <class Iterator, int_if<is_contiguous_char<Iterator>> = 0>
+boost::string_view make_view(Iterator b, Iterator e) {
+    return b == e ? boost::string_view() : boost::string_view(std::addressof(*b), e - b);
+}
+
+template <class Iterator, int_if<!is_contiguous_char<Iterator>> = 0>
+boost::iterator_range<Iterator> make_view(Iterator b, Iterator e) {return {b, e};}
+
+/******************************************************************************************/
+
+// Matches the subject without skipping and gives the matched input rather than the subject's attribute
+struct view_t {
+    template <class Subject>
+    class expression : parser_base {
+        Subject subject;
+
+    public:
+
+        explicit constexpr expression(Subject s) : subject(std::move(s)) {}
+
+        template <class T, class Window, int_if<is_check<T>> = 0>
+        auto operator()(T, Window &w) const {
+            return w.no_skip([&](auto &w) {
+                auto const b = w.begin();
+                bool const ok = recognize(subject, w);
+                return hana::make_tuple(b, w.begin(), ok);
+            });
+        }
+
+        template <class Data>
+        constexpr bool operator()(valid_t, Data const &data) const {return data[2_c];}
+
+        template <class Window>
+        bool operator()(recognize_t, Window &w) const {return w.no_skip([&](auto &w) {return recognize(subject, w);});}
+
+        template <class Window>
+        auto operator()(fused_t, Window &w) const {
+            return w.no_skip([&](auto &w) {
+                auto const b = w.begin();
+                optional_type<decltype(make_view(b, b))> ret;
+                if (recognize(subject, w)) ret.emplace(make_view(b, w.begin()));
+                return ret;
+            });
+        }
+
+        template <class T, class Data, int_if<is_parse<T>> = 0>
+        auto operator()(T, Data data) const {return make_view(data[0_c], data[1_c]);}
+
+        template <class F, int_if<is_first<F>> = 0>
+        constexpr first_set operator()(F f) const {return first(f, subject);}
+    };
+
+    constexpr view_t() {}
+
+    template <class ...Ts, int_if<sizeof...(Ts) >= 2> = 0>
+    constexpr auto operator()(Ts &&...ts) const {return expression<decltype(seq(std::forward<Ts>(ts)...))>(seq(std::forward<Ts>(ts)...));}
+
+    template <class T>
+    constexpr auto operator()(T &&t) const {return expression<std::decay_t<decltype(expr(std::forward<T>(t)))>>(expr(std::forward<T>(t)));}
+};
+
+static constexpr auto view = view_t();
+
+/******************************************************************************************/
+
+// Matches the subject and gives no attribute
+struct omit_t {
+    template <class Subject>
+    class expression : parser_base {
+        Subject subject;
+
+    public:
+
+        explicit constexpr expression(Subject s) : subject(std::move(s)) {}
+
+        template <class T, class Window, int_if<is_check<T>> = 0>
+        bool operator()(T, Window &w) const {return recognize(subject, w);}
+
+        constexpr bool operator()(valid_t, bool ok) const {return ok;}
+
+        template <class Window>
+        bool operator()(recognize_t, Window &w) const {return recognize(subject, w);}
+
+        template <class Window>
+        auto operator()(fused_t, Window &w) const {
+            return recognize(subject, w) ? optional_type<std::decay_t<decltype(hana::nothing)>>(hana::nothing) : boost::none;
+        }
+
+        template <class T, int_if<is_parse<T>> = 0>
+        constexpr auto operator()(T, bool) const {return hana::nothing;}
+
+        template <class F, int_if<is_first<F>> = 0>
+        constexpr first_set operator()(F f) const {return first(f, subject);}
+    };
+
+    constexpr omit_t() {}
+
+    template <class ...Ts, int_if<sizeof...(Ts) >= 2> = 0>
+    constexpr auto operator()(Ts &&...ts) const {return expression<decltype(seq(std::forward<Ts>(ts)...))>(seq(std::forward<Ts>(ts)...));}
+
+    template <class T>
+    constexpr auto operator()(T &&t) const {return expression<std::decay_t<decltype(expr(std::forward<T>(t)))>>(expr(std::forward<T>(t)));}
+};
+
+static constexpr auto omit = omit_t();
+
+/******************************************************************************************/
+
+}
@@ -1,2 +1,4 @@
 #include "numeric/int.hpp"
 #include "numeric/uint.hpp"
+#include "numeric/real.hpp"
+#include "numeric/binary.hpp"
@@ -0,0 +1,262 @@
+#pragma once
+#include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/parse.hpp"
+#include "../parse/window.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace xf {
+
+/******************************************************************************************/
+
+struct little_endian_t {};
+struct big_endian_t {};
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+using native_endian_t = big_endian_t;
+#else
+using native_endian_t = little_endian_t;
+#endif
+
+namespace detail {
+
+template <std::size_t N> struct unsigned_of_size;
+template <> struct unsigned_of_size<1> {using type = std::uint8_t;};
+template <> struct unsigned_of_size<2> {using type = std::uint16_t;};
+template <> struct unsigned_of_size<4> {using type = std::uint32_t;};
+template <> struct unsigned_of_size<8> {using type = std::uint64_t;};
+
+inline std::uint8_t byteswap(std::uint8_t u) {return u;}
+
+#if defined(__GNUC__)
+inline std::uint16_t byteswap(std::uint16_t u) {return __builtin_bswap16(u);}
+inline std::uint32_t byteswap(std::uint32_t u) {return __builtin_bswap32(u);}
+inline std::uint64_t byteswap(std::uint64_t u) {return __builtin_bswap64(u);}
+#else
+inline std::uint16_t byteswap(std::uint16_t u) {return static_cast<std::uint16_t>(u << 8 | u >> 8);}
+inline std::uint32_t byteswap(std::uint32_t u) {return std::uint32_t(byteswap(std::uint16_t(u))) << 16 | byteswap(std::uint16_t(u >> 16));}
+inline std::uint64_t byteswap(std::uint64_t u) {return std::uint64_t(byteswap(std::uint32_t(u))) << 32 | byteswap(std::uint32_t(u >> 32));}
+#endif
+
+// The T stored at p with the given byte order, as one unaligned load
+template <class T, class Endian>
+T load(unsigned char const *p) {
+    using U = typename unsigned_of_size<sizeof(T)>::type;
+    U u;
+    std::memcpy(&u, p, sizeof(U));
+    if (!std::is_same<Endian, native_endian_t>::value) u = byteswap(u);
+    T t;
+    std::memcpy(&t, &u, sizeof(T));
+    return t;
+}
+
+template <class Iterator, int_if<is_contiguous_byte<Iterator>> = 0>
+unsigned char const * byte_pointer(Iterator it) {return reinterpret_cast<unsigned char const *>(std::addressof(*it));}
+
+template <class T>
+constexpr bool negative(T t) {return t < T(0);}
+
+constexpr bool negative(std::uint8_t) {return false;}
+constexpr bool negative(std::uint16_t) {return false;}
+constexpr bool negative(std::uint32_t) {return false;}
+constexpr bool negative(std::uint64_t) {return false;}
+
+// Move it on by n if that stays within e
+template <class Iterator, int_if<std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value> = 0>
+bool advance_within(Iterator &it, Iterator e, std::size_t n, int) {
+    if (static_cast<std::size_t>(e - it) < n) return false;
+    it += n;
+    return true;
+}
+
+template <class Iterator>
+bool advance_within(Iterator &it, Iterator e, std::size_t n, long) {
+    auto i = it;
+    for (; n; --n, ++i) if (i == e) return false;
+    it = i;
+    return true;
+}
+
+}
+
+/******************************************************************************************/
+
+// Fixed width integer or float of either byte order, read from input of 1-byte values
+// On contiguous input the check is one bounds test and the data a pointer, so the parse is a single load
+template <class T, class Endian>
+struct binary_parser : parser_base {
+    static_assert(std::is_arithmetic<T>::value, "Binary parsers read integers and floats");
+
+    template <class Window, class Iterator=std::decay_t<decltype(std::declval<Window &>().begin())>, int_if<is_contiguous_byte<Iterator>> = 0>
+    auto operator()(check_base, Window &w) const {
+        return w.no_skip([](auto &w) {
+            auto it = w.begin();
+            unsigned char const *ret = nullptr;
+            if (detail::advance_within(it, w.end(), sizeof(T), 0)) {
+                ret = detail::byte_pointer(w.begin());
+                w.set_begin(it);
+            }
+            return ret;
+        });
+    }
+
+    template <class Window, class Iterator=std::decay_t<decltype(std::declval<Window &>().begin())>, int_if<!is_contiguous_byte<Iterator>> = 0>
+    auto operator()(check_base, Window &w) const {
+        static_assert(sizeof(*w.begin()) == 1, "Binary parsers read 1-byte values");
+        return w.no_skip([](auto &w) {
+            optional_type<std::array<unsigned char, sizeof(T)>> ret;
+            std::array<unsigned char, sizeof(T)> bytes;
+            auto it = w.begin();
+            for (auto &b : bytes) {
+                if (it == w.end()) return ret;
+                b = static_cast<unsigned char>(*it++);
+            }
+            w.set_begin(it);
+            ret = bytes;
+            return ret;
+        });
+    }
+
+    T operator()(parse_base, unsigned char const *p) const {return detail::load<T, Endian>(p);}
+
+    template <class Data>
+    T operator()(parse_base, Data const &data) const {return detail::load<T, Endian>(data->data());}
+
+    constexpr first_set operator()(first_t) const {return first_set().insert(0, 0xFF);}
+};
+
+template <class T, class Endian>
+struct is_cheap_check<binary_parser<T, Endian>> : std::true_type {};
+
+template <class T> static constexpr auto little_x = binary_parser<T, little_endian_t>();
+template <class T> static constexpr auto big_x = binary_parser<T, big_endian_t>();
+template <class T> static constexpr auto native_x = binary_parser<T, native_endian_t>();
+
+// The names of qi's binary parsers
+static constexpr auto byte_x = native_x<std::uint8_t>;
+static constexpr auto word_x = native_x<std::uint16_t>;
+static constexpr auto dword_x = native_x<std::uint32_t>;
+static constexpr auto qword_x = native_x<std::uint64_t>;
+static constexpr auto little_word_x = little_x<std::uint16_t>;
+static constexpr auto little_dword_x = little_x<std::uint32_t>;
+static constexpr auto little_qword_x = little_x<std::uint64_t>;
+static constexpr auto big_word_x = big_x<std::uint16_t>;
+static constexpr auto big_dword_x = big_x<std::uint32_t>;
+static constexpr auto big_qword_x = big_x<std::uint64_t>;
+static constexpr auto bin_float_x = native_x<float>;
+static constexpr auto bin_double_x = native_x<double>;
+static constexpr auto little_bin_float_x = little_x<float>;
+static constexpr auto little_bin_double_x = little_x<double>;
+static constexpr auto big_bin_float_x = big_x<float>;
+static constexpr auto big_bin_double_x = big_x<double>;
+
+/******************************************************************************************/
+
+// LEB128 variable length integer: 7 bits a byte, least significant first, the last byte without its top bit
+// Signed values are sign extended from the last byte's 0x40 bit; values too big for T don't match
+template <class T>
+struct leb128_parser : parser_base {
+    static_assert(std::is_integral<T>::value && sizeof(T) <= 8, "LEB128 decodes integers of up to 64 bits");
+
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        return w.no_skip([](auto &w) {
+            optional_type<T> ret;
+            auto it = w.begin();
+            std::uint64_t u = 0;
+            unsigned shift = 0;
+            while (true) {
+                if (it == w.end() || shift >= 64) return ret;
+                auto const b = static_cast<std::uint64_t>(static_cast<unsigned char>(*it++));
+                auto const bits = b & 0x7F;
+                // The 10th byte has room for only the top bit of 64
+                if (shift == 63 && bits != 0 && (std::is_unsigned<T>::value ? bits != 1 : bits != 0x7F)) return ret;
+                u |= bits << shift;
+                shift += 7;
+                if (!(b & 0x80)) {
+                    if (std::is_signed<T>::value && shift < 64 && (b & 0x40)) u |= ~std::uint64_t(0) << shift;
+                    break;
+                }
+            }
+            if (!fits(u, std::is_signed<T>())) return ret;
+            w.set_begin(it);
+            ret = static_cast<T>(u);
+            return ret;
+        });
+    }
+
+    template <class Data>
+    T operator()(parse_base, Data const &data) const {return *data;}
+
+    constexpr first_set operator()(first_t) const {return first_set().insert(0, 0xFF);}
+
+private:
+
+    static bool fits(std::uint64_t u, std::false_type) {return u <= std::numeric_limits<T>::max();}
+
+    static bool fits(std::uint64_t u, std::true_type) {
+        auto const i = static_cast<std::int64_t>(u);
+        return i >= std::numeric_limits<T>::min() && i <= std::numeric_limits<T>::max();
+    }
+};
+
+template <class T>
+struct is_cheap_check<leb128_parser<T>> : std::true_type {};
+
+static constexpr auto uleb128_x = leb128_parser<std::uint64_t>();
+static constexpr auto sleb128_x = leb128_parser<std::int64_t>();
+
+/******************************************************************************************/
+
+// A length given by the prefix parser followed by that many bytes, whose copy is the attribute
+template <class Prefix>
+class blob_parser : parser_base {
+    Prefix m_prefix;
+
+public:
+
+    constexpr blob_parser(Prefix p) : m_prefix(std::move(p)) {}
+
+    template <class Tag, class Window, int_if<is_check<Tag>> = 0>
+    auto operator()(Tag tag, Window &w) const {
+        return w.no_skip([&](auto &w) {
+            optional_type<std::pair<std::decay_t<decltype(w.begin())>, std::size_t>> ret;
+            auto const save = w.begin();
+            auto d = check(tag, m_prefix, w);
+            if (!valid(m_prefix, d)) {w.set_begin(save); return ret;}
+            auto const n = parse(parse_c, m_prefix, std::move(d));
+            auto const b = w.begin();
+            auto e = b;
+            if (detail::negative(n) || !detail::advance_within(e, w.end(), static_cast<std::size_t>(n), 0)) {w.set_begin(save); return ret;}
+            w.set_begin(e);
+            ret.emplace(b, static_cast<std::size_t>(n));
+            return ret;
+        });
+    }
+
+    template <class Data>
+    auto operator()(parse_base, Data const &data) const {
+        using value_type = std::decay_t<decltype(*data->first)>;
+        return container_type<value_type>(data->first, std::next(data->first, data->second));
+    }
+
+    constexpr first_set operator()(first_t) const {return first(m_prefix);}
+};
+
+template <class Prefix>
+struct is_cheap_check<blob_parser<Prefix>> : std::true_type {};
+
+// blob(big_word_x) reads a 16-bit big-endian length and then that many bytes
+template <class Prefix>
+constexpr auto blob(Prefix p) {return blob_parser<Prefix>(std::move(p));}
+
+/******************************************************************************************/
+
+}
@@ -10,26 +10,30 @@ struct int_parser : parser_base {
     template <class Window>
     auto operator()(check_base, Window &w) const {
         return w.no_skip([](auto &w) {
-            bool positive = true;
-            if (w) {
-                if (w && *w == '-') {++w; positive = false;}
-                else if (w && *w == '+') ++w;
+            using U = std::make_unsigned_t<T>;
+            optional_type<T> ret;
+            auto it = w.begin();
+            bool const negative = it != w.end() && *it == '-';
+            if (it != w.end() && (negative || *it == '+')) ++it;
+            // The magnitude may reach one past the maximum when negative
+            U u = 0;
+            if (extract_digits<Radix>(it, w.end(), u, U(U(std::numeric_limits<T>::max()) + negative))) {
+                w.set_begin(it);
+                ret = negative ? (u == 0 ? T(0) : T(-T(u - 1) - 1)) : T(u);
             }
-            return std::make_pair(digit_range(w, hana::size_c<std::numeric_limits<T>::digits10 - 2>), positive);
+            return ret;
         });
     }
 
     template <class Data>
-    bool operator()(valid_t, Data const &data) const {return data.first[2_c];}
+    T operator()(parse_base, Data data) const {return *data;}
 
-    template <class Data>
-    T operator()(parse_base, Data data) const {
-        auto const n = std::distance(data.first[0_c], data.first[1_c]);
-        auto t = std::inner_product(data.first[0_c], data.first[1_c], mask<T, Radix>.end() - n, static_cast<T>(0)) - remainder<T, Radix>[n];
-        return data.second ? t : -t;
-    }
+    constexpr first_set operator()(first_t) const {return digits_first<Radix>().insert('+').insert('-');}
 };
 
+template <class T, unsigned Radix>
+struct is_cheap_check<int_parser<T, Radix>> : std::true_type {};
+
 /******************************************************************************************/
 
 #define BOOST_SPIRIT_X3_INT_PARSER(int_type, name)                              \
@@ -0,0 +1,286 @@
+#pragma once
+#include "uint.hpp"
+#include "powers.hpp"
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Check data of a real number: up to 19 significant digits and the power of ten scaling them
+// Where the number lies is kept too, for when there were more digits than that
+template <class Iterator>
+struct decimal_number {
+    enum kind_type {finite, infinity, nan};
+
+    std::uint64_t digits = 0;
+    std::int64_t exponent = 0;
+    Iterator begin, end;
+    kind_type kind = finite;
+    bool negative = false;
+    bool truncated = false; // nonzero digits were dropped after the first 19
+};
+
+/******************************************************************************************/
+
+namespace detail {
+
+template <class Iterator>
+bool skip_word(Iterator &it, Iterator e, char const *word) {
+    auto i = it;
+    for (; *word; ++word, ++i) if (i == e || (*i | 0x20) != *word) return false;
+    it = i;
+    return true;
+}
+
+// Digits in the form x3's real_policies accept: [+-] digits [. digits] [(e|E) [+-] digits], or nan, inf and infinity
+template <class Iterator>
+bool scan_decimal(Iterator &it, Iterator e, decimal_number<Iterator> &d) {
+    d.begin = it;
+    auto i = it;
+    d.negative = i != e && *i == '-';
+    if (i != e && (d.negative || *i == '+')) ++i;
+
+    if (skip_word(i, e, "nan")) d.kind = d.nan;
+    else if (skip_word(i, e, "inf")) {skip_word(i, e, "inity"); d.kind = d.infinity;}
+    if (d.kind != d.finite) {it = d.end = i; return true;}
+
+    unsigned kept = 0;
+    bool any = false;
+    // Leading zeros don't count towards the 19 digits kept
+    auto const digit = [&](unsigned v, int scale) {
+        any = true;
+        if (kept == 0 && v == 0) {d.exponent += scale < 0 ? -1 : 0; return;}
+        if (kept < 19) {d.digits = d.digits * 10 + v; ++kept; d.exponent += scale < 0 ? -1 : 0;}
+        else {d.truncated |= v != 0; d.exponent += scale > 0 ? 1 : 0;}
+    };
+    for (unsigned v; i != e && (v = digit_value<10>(*i)) < 10; ++i) digit(v, 1);
+    if (i != e && *i == '.') {
+        auto const point = i;
+        ++i;
+        for (unsigned v; i != e && (v = digit_value<10>(*i)) < 10; ++i) digit(v, -1);
+        if (!any) i = point;
+    }
+    if (!any) return false;
+
+    // An exponent without digits is left for whatever follows
+    if (i != e && (*i | 0x20) == 'e') {
+        auto j = i;
+        ++j;
+        bool const minus = j != e && *j == '-';
+        if (j != e && (minus || *j == '+')) ++j;
+        std::int64_t x = 0;
+        bool exp_digits = false;
+        for (unsigned v; j != e && (v = digit_value<10>(*j)) < 10; ++j, exp_digits = true)
+            if (x < 1000000000) x = x * 10 + v; // far beyond any finite result either way
+        if (exp_digits) {d.exponent += minus ? -x : x; i = j;}
+    }
+    it = d.end = i;
+    return true;
+}
+
+/******************************************************************************************/
+
+template <class T> struct binary_format;
+
+template <>
+struct binary_format<double> {
+    using bits_type = std::uint64_t;
+    static constexpr int mantissa_bits = 52, minimum_exponent = -1023, infinite_power = 0x7FF;
+    static constexpr int min_round_to_even = -4, max_round_to_even = 23;
+    static constexpr int smallest_power_of_ten = -342, largest_power_of_ten = 308;
+    static constexpr int max_exact_power = 22;
+    static double exact_power(int q) {
+        static constexpr double p[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+        return p[q];
+    }
+    static double slow(char const *s) {return std::strtod(s, nullptr);}
+};
+
+template <>
+struct binary_format<float> {
+    using bits_type = std::uint32_t;
+    static constexpr int mantissa_bits = 23, minimum_exponent = -127, infinite_power = 0xFF;
+    static constexpr int min_round_to_even = -17, max_round_to_even = 10;
+    static constexpr int smallest_power_of_ten = -65, largest_power_of_ten = 38;
+    static constexpr int max_exact_power = 10;
+    static float exact_power(int q) {
+        static constexpr float p[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+        return p[q];
+    }
+    static float slow(char const *s) {return std::strtof(s, nullptr);}
+};
+
+struct uint128 {std::uint64_t high, low;};
+
+inline uint128 full_multiply(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    auto const r = static_cast<unsigned __int128>(a) * b;
+    return {static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r)};
+#else
+    std::uint64_t const a0 = a & 0xFFFFFFFF, a1 = a >> 32, b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+    std::uint64_t const w0 = a0 * b0, t = a1 * b0 + (w0 >> 32), w1 = (t & 0xFFFFFFFF) + a0 * b1;
+    return {a1 * b1 + (t >> 32) + (w1 >> 32), a * b};
+#endif
+}
+
+inline unsigned leading_zeros(std::uint64_t w) {
+#if defined(__GNUC__)
+    return __builtin_clzll(w);
+#else
+    unsigned n = 0;
+    for (; !(w >> 63); w <<= 1) ++n;
+    return n;
+#endif
+}
+
+// Binary mantissa and biased exponent
+struct adjusted_mantissa {
+    std::uint64_t mantissa;
+    int power2;
+    bool operator==(adjusted_mantissa const &o) const {return mantissa == o.mantissa && power2 == o.power2;}
+};
+
+// Eisel-Lemire: the nearest binary value to w * 10^q, for any w != 0 given exactly
+// A second, lower multiply settles every case (Mushtak and Lemire, "Fast number parsing without fallback", 2023)
+template <class T>
+adjusted_mantissa compute_float(std::int64_t q, std::uint64_t w) {
+    using B = binary_format<T>;
+    if (w == 0 || q < B::smallest_power_of_ten) return {0, 0};
+    if (q > B::largest_power_of_ten) return {0, B::infinite_power};
+
+    auto const lz = leading_zeros(w);
+    w <<= lz;
+    auto const index = 2 * (q - smallest_power_of_five);
+    auto product = full_multiply(w, powers_of_five_128[index]);
+    std::uint64_t const precision_mask = ~std::uint64_t(0) >> (B::mantissa_bits + 3);
+    if ((product.high & precision_mask) == precision_mask) {
+        auto const low = full_multiply(w, powers_of_five_128[index + 1]);
+        product.low += low.high;
+        if (low.high > product.low) ++product.high;
+    }
+
+    int const upper = static_cast<int>(product.high >> 63);
+    int const shift = upper + 64 - B::mantissa_bits - 3;
+    adjusted_mantissa a;
+    a.mantissa = product.high >> shift;
+    // floor(log2(10^q)) + 63, exact over the whole table
+    a.power2 = static_cast<int>((((152170 + 65536) * q) >> 16) + 63) + upper - static_cast<int>(lz) - B::minimum_exponent;
+
+    if (a.power2 <= 0) { // subnormal
+        if (-a.power2 + 1 >= 64) return {0, 0};
+        a.mantissa >>= -a.power2 + 1;
+        a.mantissa += a.mantissa & 1;
+        a.mantissa >>= 1;
+        a.power2 = a.mantissa < (std::uint64_t(1) << B::mantissa_bits) ? 0 : 1;
+        return a;
+    }
+    // Exactly halfway: round to even
+    if (product.low <= 1 && q >= B::min_round_to_even && q <= B::max_round_to_even && (a.mantissa & 3) == 1
+        && (a.mantissa << shift) == product.high) a.mantissa &= ~std::uint64_t(1);
+    a.mantissa += a.mantissa & 1;
+    a.mantissa >>= 1;
+    if (a.mantissa >= (std::uint64_t(2) << B::mantissa_bits)) {
+        a.mantissa = std::uint64_t(1) << B::mantissa_bits;
+        ++a.power2;
+    }
+    a.mantissa &= ~(std::uint64_t(1) << B::mantissa_bits);
+    if (a.power2 >= B::infinite_power) return {0, B::infinite_power};
+    return a;
+}
+
+template <class T>
+T make_float(adjusted_mantissa a, bool negative) {
+    using bits_type = typename binary_format<T>::bits_type;
+    auto const bits = static_cast<bits_type>(a.mantissa | (std::uint64_t(a.power2) << binary_format<T>::mantissa_bits)
+        | (std::uint64_t(negative) << (8 * sizeof(T) - 1)));
+    T t;
+    std::memcpy(&t, &bits, sizeof(T));
+    return t;
+}
+
+// Correctly rounded conversion of all the digits, for the rare case the first 19 don't decide it
+// The digits are given to strtod without a decimal point, so the locale can't change their meaning
+template <class T, class Iterator>
+T slow_decimal(decimal_number<Iterator> const &d) {
+    std::string s(d.negative, '-');
+    std::int64_t scale = 0;
+    bool fraction = false;
+    auto i = d.begin;
+    for (; i != d.end && (*i | 0x20) != 'e'; ++i) {
+        if (*i == '.') fraction = true;
+        else if (digit_value<10>(*i) < 10) {s += static_cast<char>(*i); scale -= fraction;}
+    }
+    std::int64_t explicit_exponent = 0;
+    if (i != d.end) {
+        bool const minus = ++i != d.end && *i == '-';
+        if (i != d.end && (minus || *i == '+')) ++i;
+        for (; i != d.end; ++i) if (explicit_exponent < 1000000000) explicit_exponent = explicit_exponent * 10 + digit_value<10>(*i);
+        if (minus) explicit_exponent = -explicit_exponent;
+    }
+    s += 'e';
+    s += std::to_string(explicit_exponent + scale);
+    return binary_format<T>::slow(s.c_str());
+}
+
+}
+
+/******************************************************************************************/
+
+// Nearest T to a decimal number, rounding ties to even
+template <class T, class Iterator>
+T decimal_to(decimal_number<Iterator> const &d) {
+    using B = detail::binary_format<T>;
+    if (d.kind == d.nan) return d.negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+    if (d.kind == d.infinity) return d.negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+
+    // Clinger: both factors are exact so a single rounding gives the answer
+    if (!d.truncated && d.exponent >= -B::max_exact_power && d.exponent <= B::max_exact_power
+        && d.digits <= (std::uint64_t(2) << B::mantissa_bits)) {
+        T t = static_cast<T>(d.digits);
+        t = d.exponent < 0 ? t / B::exact_power(-d.exponent) : t * B::exact_power(d.exponent);
+        return d.negative ? -t : t;
+    }
+    auto const a = detail::compute_float<T>(d.exponent, d.digits);
+    // With digits dropped the value lies between the first 19 and the next number up
+    if (d.truncated && !(a == detail::compute_float<T>(d.exponent, d.digits + 1))) return detail::slow_decimal<T>(d);
+    return detail::make_float<T>(a, d.negative);
+}
+
+/******************************************************************************************/
+
+template <class T>
+struct real_parser : parser_base {
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        return w.no_skip([](auto &w) {
+            optional_type<decimal_number<std::decay_t<decltype(w.begin())>>> ret;
+            auto it = w.begin();
+            ret.emplace();
+            if (detail::scan_decimal(it, w.end(), *ret)) w.set_begin(it);
+            else ret.reset();
+            return ret;
+        });
+    }
+
+    template <class Data>
+    T operator()(parse_base, Data const &data) const {return decimal_to<T>(*data);}
+
+    constexpr first_set operator()(first_t) const {
+        return digits_first<10>().insert('+').insert('-').insert('.').insert('n').insert('N').insert('i').insert('I');
+    }
+};
+
+template <class T>
+struct is_cheap_check<real_parser<T>> : std::true_type {};
+
+static constexpr auto double_x = real_parser<double>();
+static constexpr auto float_x = real_parser<float>();
+
+/******************************************************************************************/
+
+}
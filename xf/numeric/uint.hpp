@@ -1,75 +1,93 @@
 #pragma once
 #include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
 
-#include <boost/hana/power.hpp>
-#include <boost/hana/plus.hpp>
-#include <boost/hana/greater.hpp>
-#include <boost/hana/scan_left.hpp>
-#include <boost/hana/reverse.hpp>
-#include <boost/hana/append.hpp>
 #include <cstdint>
-#include <numeric>
-#include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
 
 namespace xf {
 
 /******************************************************************************************/
 
-template <class T, class From, std::size_t ...Is>
-constexpr auto make_array(From const &f, std::index_sequence<Is...>) {
-    return std::array<T, sizeof...(Is)>{hana::at_c<Is>(f)...};
+// Value of the digit c in the given radix, or at least Radix if c isn't one
+template <unsigned Radix, class Char>
+constexpr unsigned digit_value(Char c) {
+    static_assert(Radix >= 2 && Radix <= 36, "Unsupported radix");
+    unsigned const d = static_cast<unsigned>(c - '0');
+    if (Radix <= 10 || d < 10) return d;
+    unsigned const a = static_cast<unsigned>((c | 0x20) - 'a');
+    return a < Radix - 10 ? a + 10 : Radix;
 }
 
 /******************************************************************************************/
 
-template <class T, class R>
-constexpr auto radix_mask(R radix) {
-    constexpr auto is = hana::reverse(indices_c<std::numeric_limits<T>::digits10 - 2>);
-    constexpr auto ts = hana::transform(is, hana::partial(hana::power, radix));
-    return make_array<T>(ts, std::make_index_sequence<decltype(hana::length(ts))::value>());
-}
+namespace detail {
 
-/******************************************************************************************/
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+static constexpr bool swar_digits = true;
+#else
+static constexpr bool swar_digits = false;
+#endif
 
-template <class R, class S>
-struct radix_increment {
-    R radix;
-    S start;
-    template <class I, class T>
-    constexpr auto operator()(T t, I) const {return t * radix + start;}
-};
+// Whether all 8 bytes of v (in memory order) are '0' to '9'
+inline bool eight_digits(std::uint64_t v) {
+    return ((v & 0xF0F0F0F0F0F0F0F0) | (((v + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+}
 
-template <class T, class R, class S>
-constexpr auto radix_remainder(R radix, S start) {
-    constexpr auto is = indices_c<std::numeric_limits<T>::digits10 - 2>;
-    constexpr auto ts = hana::scan_left(is, hana::integral_constant<T, 0>(), radix_increment<R, S>{radix, start});
-    return make_array<T>(ts, std::make_index_sequence<decltype(hana::length(ts))::value>());
+// Value of 8 decimal digits read little-endian, with 3 multiplies instead of 8
+inline std::uint32_t eight_digits_value(std::uint64_t v) {
+    v -= 0x3030303030303030;
+    v = v * 10 + (v >> 8);
+    v = ((v & 0x000000FF000000FF) * (100 + (1000000ULL << 32)) + ((v >> 16) & 0x000000FF000000FF) * (1 + (10000ULL << 32))) >> 32;
+    return static_cast<std::uint32_t>(v);
 }
 
-/******************************************************************************************/
+// Decimal runs in contiguous chars are taken 8 digits at a time while they last
+template <unsigned Radix, class T, class Iterator, int_if<Radix == 10 && swar_digits
+    && is_contiguous_char<Iterator> && std::numeric_limits<T>::digits10 >= 8> = 0>
+bool leading_digits(Iterator &it, Iterator e, T &t, T limit, int) {
+    if (it == e) return true;
+    char const * const b = std::addressof(*it), *p = b, * const pe = b + (e - it);
+    for (std::uint64_t v; pe - p >= 8; p += 8) {
+        std::memcpy(&v, p, 8);
+        if (!eight_digits(v)) break;
+        T const chunk = eight_digits_value(v);
+        if (t > (limit - chunk) / 100000000) return false;
+        t = t * 100000000 + chunk;
+    }
+    it += p - b;
+    return true;
+}
 
-template <class T, unsigned Radix>
-static constexpr auto remainder = radix_remainder<T>(hana::integral_constant<T, Radix>(), hana::integral_constant<T, '0'>());
-template <class T, unsigned Radix>
-static constexpr auto mask = radix_mask<T>(hana::integral_constant<T, Radix>());
+template <unsigned Radix, class T, class Iterator>
+bool leading_digits(Iterator &, Iterator, T &, T, long) {return true;}
 
-/******************************************************************************************/
+}
+
+// Accumulate the digits starting at it into t, which must not exceed limit
+// Returns false if there were no digits or the value overflowed; it is then meaningless
+template <unsigned Radix, class T, class Iterator>
+bool extract_digits(Iterator &it, Iterator e, T &t, T limit) {
+    static_assert(std::is_unsigned<T>::value, "Digits are accumulated unsigned");
+    auto const b = it;
+    if (!detail::leading_digits<Radix>(it, e, t, limit, 0)) return false;
+    T const most = limit / Radix, last = limit % Radix;
+    for (unsigned d; it != e && (d = digit_value<Radix>(*it)) < Radix; ++it) {
+        if (t >= most && (t > most || d > last)) return false;
+        t = t * Radix + d;
+    }
+    return it != b;
+}
 
-template <class Window, class N>
-auto digit_range(Window &w, N n) {
-    auto r = hana::make_tuple(w.begin(), w.begin(), w && std::isdigit(*w));
-    if (!r[2_c]) return r;
-
-    while (w && *w == '0') ++w;
-    unsigned digits = 0;
-    r[0_c] = w.begin(); // set start of nonzeros
-    while (w && std::isdigit(*w)) {++w; ++digits;}
-
-    if (digits > n) { // revert window and return false
-        r[2_c] = false;
-        w.set_begin(r[1_c]);
-    } else r[1_c] = w.begin(); // set end of nonzeros
-    return r;
+// First set of a number in the given radix
+template <unsigned Radix>
+constexpr first_set digits_first() {
+    first_set s;
+    for (unsigned c = 0; c != 256; ++c) if (digit_value<Radix>(static_cast<char>(c)) < Radix) s.insert(c);
+    return s;
 }
 
 /******************************************************************************************/
@@ -79,20 +97,26 @@ struct uint_parser : parser_base {
     template <class Window>
     auto operator()(check_base, Window &w) const {
         return w.no_skip([](auto &w) {
-            return digit_range(w, hana::size_c<std::numeric_limits<T>::digits10>);
+            optional_type<T> ret;
+            auto it = w.begin();
+            T t = 0;
+            if (extract_digits<Radix>(it, w.end(), t, std::numeric_limits<T>::max())) {
+                w.set_begin(it);
+                ret = t;
+            }
+            return ret;
         });
     }
 
     template <class Data>
-    bool operator()(valid_t, Data const &data) const {return data[2_c];}
+    T operator()(parse_base, Data data) const {return *data;}
 
-    template <class Data>
-    T operator()(parse_base, Data data) const {
-        auto const n = std::distance(data[0_c], data[1_c]);
-        return std::inner_product(data[0_c], data[1_c], mask<T, Radix>.end() - n, static_cast<T>(0)) - remainder<T, Radix>[n];
-    }
+    constexpr first_set operator()(first_t) const {return digits_first<Radix>();}
 };
 
+template <class T, unsigned Radix>
+struct is_cheap_check<uint_parser<T, Radix>> : std::true_type {};
+
 /******************************************************************************************/
 
 #define BOOST_SPIRIT_X3_UINT_PARSER(uint_type, name)                            \
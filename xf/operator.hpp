@@ -2,6 +2,7 @@
 #include "operator/kleene.hpp"
 #include "operator/list.hpp"
 #include "operator/optional.hpp"
+#include "operator/parallel.hpp"
 #include "operator/plus.hpp"
 #include "operator/restriction.hpp"
 #include "operator/sequence.hpp"
@@ -1,7 +1,11 @@
 #pragma once
 #include "../support/optional_variant.hpp"
 #include "../parse/parse.hpp"
+#include "../support/profile.hpp"
+#include <boost/hana/all_of.hpp>
+#include <boost/hana/any_of.hpp>
 #include <boost/hana/for_each.hpp>
+#include <cstdint>
 
 namespace xf {
 
@@ -37,9 +41,89 @@ static auto constexpr alternative_parse_c = hana::template_<alternative_parse_t>
 
 /******************************************************************************************/
 
+template <std::size_t N>
+using branch_mask = std::conditional_t<(N <= 8), std::uint8_t,
+                    std::conditional_t<(N <= 16), std::uint16_t,
+                    std::conditional_t<(N <= 32), std::uint32_t, std::uint64_t>>>;
+
+// For each leading 8-bit character, the branches of an alternative which could match it
+// A table only covers the branches whose types are empty if Shared, or the others if not
+template <std::size_t N, bool Shared, bool=(N <= 64)>
+class branch_table {
+    using mask = branch_mask<N>;
+    mask m_chars[256];
+    mask m_end;
+    bool m_useful;
+
+    template <class F, class ...Ts, std::size_t ...Is>
+    constexpr branch_table(F f, hana::tuple<Ts...> const &t, std::index_sequence<Is...>) : m_chars{}, m_end(0), m_useful(false) {
+        bool const covered[] = {std::is_empty<Ts>::value == Shared...};
+        first_set const sets[] = {(covered[Is] ? first(f, hana::at_c<Is>(t)) : first_set())...};
+        mask all = 0;
+        for (std::size_t i = 0; i != N; ++i) {
+            if (!covered[i]) continue;
+            all |= mask(1) << i;
+            if (sets[i].nullable()) m_end |= mask(1) << i;
+            for (unsigned c = 0; c != 256; ++c)
+                if (sets[i].nullable() || sets[i].contains(c)) m_chars[c] |= mask(1) << i;
+        }
+        // Only worth consulting if some character rules out some branch
+        for (unsigned c = 0; c != 256; ++c) m_useful = m_useful || m_chars[c] != all;
+    }
+
+public:
+
+    template <class F, class ...Ts>
+    constexpr branch_table(F f, hana::tuple<Ts...> const &t) : branch_table(f, t, std::index_sequence_for<Ts...>()) {}
+
+    constexpr bool useful() const {return m_useful;}
+
+    template <class Window>
+    std::uint64_t operator()(Window const &w) const {return w ? m_chars[static_cast<unsigned char>(*w)] : m_end;}
+};
+
+// Too many branches to fit a mask
+template <std::size_t N, bool Shared>
+struct branch_table<N, Shared, false> {
+    template <class F, class T>
+    constexpr branch_table(F, T const &) {}
+
+    constexpr bool useful() const {return false;}
+
+    template <class Window>
+    std::uint64_t operator()(Window const &) const {return ~std::uint64_t(0);}
+};
+
+// No branches to cover
+struct no_branch_table {
+    template <class F, class T>
+    constexpr no_branch_table(F, T const &) {}
+
+    constexpr bool useful() const {return false;}
+
+    template <class Window>
+    std::uint64_t operator()(Window const &) const {return 0;}
+};
+
+/******************************************************************************************/
+
 template <class ...Parsers>
 class alternative : public parser_base {
+    // Branches holding no data (such as rules) have the same first sets in every instance, so their
+    // table is built once per type, on first use so that it can follow rules; the others are built up front
+    static constexpr bool any_empty = decltype(hana::any_of(hana::tuple_t<Parsers...>, hana::trait<std::is_empty>))::value;
+    static constexpr bool all_empty = decltype(hana::all_of(hana::tuple_t<Parsers...>, hana::trait<std::is_empty>))::value;
+
+    using shared_table = std::conditional_t<any_empty, branch_table<sizeof...(Parsers), true>, no_branch_table>;
+    using own_table = std::conditional_t<all_empty, no_branch_table, branch_table<sizeof...(Parsers), false>>;
+
     hana::tuple<Parsers...> m_parsers;
+    own_table m_table;
+
+    shared_table const & shared() const {
+        static shared_table const table(rule_first_c, m_parsers);
+        return table;
+    }
 
     template <class ...Ts> struct ID;
 
@@ -52,17 +136,51 @@ class alternative : public parser_base {
         return hana::type_c<optional_variant<true, alternative_check_t<Parsers, Window>...>>;
     }
 
-    template <class R, class Tag, class Window>
-    R do_check(Tag tag, Window &w) const {
+    template <class F, std::size_t ...Is>
+    constexpr first_set first_union(F f, std::index_sequence<Is...>) const {
+        first_set s;
+        bool _[] = {true, (s = s | first(f, hana::at_c<Is>(m_parsers)), true)...};
+        return (void) _, s;
+    }
+
+    template <class R, class Tag, class Window, std::size_t I>
+    static bool check_branch(alternative const &a, R &ret, Tag tag, Window &w) {
+        auto const &p = a.m_parsers[hana::size_c<I>];
+        auto t = profiled(tag, &a, I, nullptr, w, [&] {return check(tag, p, w);}, [&](auto const &d) {return valid(p, d);});
+        if (!valid(p, t)) return false;
+        ret.emplace(hana::llong_c<I>, std::move(t));
+        return true;
+    }
+
+    // The first-character table only applies to 8-bit characters compared exactly
+    template <class Window>
+    bool use_table(Window const &w) const {
+        return sizeof(std::decay_t<decltype(*w)>) == 1
+            && std::is_same<std::decay_t<decltype(w.compare())>, hana::equal_t>::value
+            && (m_table.useful() || (any_empty && shared().useful()));
+    }
+
+    template <class Window>
+    std::uint64_t branch_mask_at(Window const &w) const {return m_table(w) | (any_empty ? shared()(w) : 0);}
+
+    template <class R, class Tag, class Window, std::size_t ...Is>
+    R do_check(Tag tag, Window &w, std::index_sequence<Is...>) const {
         R ret;
-        hana::for_each(indices_c<sizeof...(Parsers)>, [&](auto i) {
-            if (ret) return;
-            auto t = check(tag, m_parsers[i], w);
-            if (valid(m_parsers[i], t)) ret.emplace(i, std::move(t));
-        });
+        // Skip the branches which can't start with the current character, keeping their order
+        std::uint64_t const m = use_table(w) ? branch_mask_at(w) : ~std::uint64_t(0);
+        bool _[] = {true, (ret || !(m >> Is % 64 & 1) || check_branch<R, Tag, Window, Is>(*this, ret, tag, w))...};
+        (void) _;
         return ret;
     }
 
+    template <class Window, std::size_t ...Is>
+    bool do_recognize(Window &w, std::index_sequence<Is...>) const {
+        bool ret = false;
+        std::uint64_t const m = use_table(w) ? branch_mask_at(w) : ~std::uint64_t(0);
+        bool _[] = {true, (ret = ret || ((m >> Is % 64 & 1) && recognize(hana::at_c<Is>(m_parsers), w)))...};
+        return (void) _, ret;
+    }
+
     template <bool B, class Tag, class Data, int_if<!B> = 0>
     auto parse_type(Tag tag, Data data) const {
         return variant_c<false>(hana::transform(indices_c<sizeof...(Parsers)>,
@@ -80,27 +198,33 @@ class alternative : public parser_base {
 
 public:
 
-    auto const & parsers() const {return m_parsers;}
+    constexpr auto const & parsers() const {return m_parsers;}
 
     template <class ...Ts>
-    constexpr alternative(Ts &&...ts) : m_parsers(std::forward<Ts>(ts)...) {}
+    constexpr alternative(Ts &&...ts) : m_parsers(std::forward<Ts>(ts)...), m_table(first_c, m_parsers) {}
 
     template <class Tag, class Window, int_if<is_check<Tag>> = 0>
     auto operator()(Tag const tag, Window &w) const {
         constexpr auto id = hana::type_c<ID<Window>>;
         auto cycle = (tag.count(id) >= recurse_limit);
-        auto tag2 = hana::if_(cycle, check_c, tag.plus(id));
+        auto tag2 = hana::if_(cycle, tag.restart(), tag.plus(id));
         using R = decltype(*check_type<cycle>(tag2, w));
-        return do_check<R>(tag2, w);
+        return do_check<R>(tag2, w, std::index_sequence_for<Parsers...>());
     }
 
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag const tag, Data &&data) const {
         constexpr auto id = hana::type_c<ID<std::decay_t<Data>>>;
         auto cycle = (tag.count(id) >= recurse_limit);
-        auto tag2 = hana::if_(cycle, parse_c, tag.plus(id));
+        auto tag2 = hana::if_(cycle, tag.restart(), tag.plus(id));
         return do_parse<decltype(*parse_type<cycle>(tag2, std::forward<Data>(data)))>(tag2, std::forward<Data>(data));
     }
+
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {return do_recognize(w, std::index_sequence_for<Parsers...>());}
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first_union(f, std::index_sequence_for<Parsers...>());}
 };
 
 /******************************************************************************************/
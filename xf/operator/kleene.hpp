@@ -6,7 +6,31 @@ namespace xf {
 
 /******************************************************************************************/
 
-// replace vector<void> with size_t probably
+// Check data of a repeat over cheaply checked elements: where they start and how many matched
+// The elements are checked again while parsing, so only the attribute container is ever built
+template <class Window>
+struct repeat_span {
+    optional_type<Window> begin; // windows need not be default constructible
+    std::size_t count = 0;
+
+    bool empty() const {return count == 0;}
+    std::size_t size() const {return count;}
+};
+
+// Check data of a repeat whose elements commit: each one is parsed as soon as it has been checked,
+// before the input it commits is released, so only the attributes are kept
+template <class Container>
+struct parsed_repeat {
+    Container values;
+
+    bool empty() const {return values.empty();}
+    std::size_t size() const {return values.size();}
+};
+
+template <class Container>
+parsed_repeat<Container> make_parsed_repeat(Container c) {return {std::move(c)};}
+
+/******************************************************************************************/
 
 template <class Subject>
 class kleene : parser_base {
@@ -14,22 +38,46 @@ class kleene : parser_base {
 
 public:
 
-    decltype(auto) subject() const {return m_subject;}
+    constexpr Subject const & subject() const {return m_subject;}
 
     constexpr kleene(Subject s) : m_subject(std::move(s)) {}
 
-    template <class Tag, class Window, int_if<is_check<Tag>> = 0>
+    template <class Tag, class Window, int_if<is_check<Tag> && !is_cheap_check<Subject>::value && !has_commit<Subject>::value> = 0>
     auto operator()(Tag tag, Window &w) const {
-        container_type<decltype(check(tag, subject(), w))> ret;
+        check_container_type<decltype(check(tag, subject(), w))> ret;
         append(ret, check(tag, subject(), w));
         while (valid(subject(), ret.back())) append(ret, check(tag, subject(), w));
         ret.pop_back();
         return ret;
     }
 
+    template <class Tag, class Window, int_if<is_check<Tag> && is_cheap_check<Subject>::value && !has_commit<Subject>::value> = 0>
+    auto operator()(Tag tag, Window &w) const {
+        repeat_span<Window> ret{w, take_run(subject(), w, 0)};
+        while (valid(subject(), check(tag, subject(), w))) ++ret.count;
+        return ret;
+    }
+
+    template <class Tag, class Window, int_if<is_check<Tag> && has_commit<Subject>::value> = 0>
+    auto operator()(Tag, Window &w) const {return make_parsed_repeat(std::move(*(*this)(fused_c, w)));}
+
     template <class Data>
     constexpr auto operator()(valid_t, Data const &data) const {return hana::true_c;}
 
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {
+        while (recognize(m_subject, w)) {}
+        return true;
+    }
+
+    template <class Window>
+    auto operator()(fused_t, Window &w) const {
+        optional_type<container_type<typename decltype(fused(subject(), w))::value_type>> ret;
+        ret.emplace();
+        for (auto t = fused(subject(), w); t; t = fused(subject(), w)) append(*ret, std::move(*t));
+        return ret;
+    }
+
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag tag, Data data) const {
         container_type<decltype(parse(tag, subject(), std::move(data.front())))> ret;
@@ -37,6 +85,20 @@ public:
         for (auto &&d : data) append(ret, parse(tag, subject(), std::move(d)));
         return ret;
     }
+
+    template <class Tag, class Container, int_if<is_parse<Tag>> = 0>
+    Container operator()(Tag, parsed_repeat<Container> data) const {return std::move(data.values);}
+
+    template <class Tag, class Window, int_if<is_parse<Tag>> = 0>
+    auto operator()(Tag tag, repeat_span<Window> data) const {
+        container_type<decltype(parse(tag, subject(), check(check_c, subject(), *data.begin)))> ret;
+        ret.reserve(data.count);
+        for (; data.count; --data.count) append(ret, parse(tag, subject(), check(check_c, subject(), *data.begin)));
+        return ret;
+    }
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, m_subject).with_nullable(true);}
 };
 
 /******************************************************************************************/
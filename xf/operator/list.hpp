@@ -5,25 +5,84 @@ namespace xf {
 
 /******************************************************************************************/
 
-// replace vector<void> with size_t probably
-
 template <class Subject, class Separator>
 class list : public plus<Subject> {
-    Separator separator;
+    Separator m_separator;
+    using is_cheap_list = std::integral_constant<bool, is_cheap_check<Subject>::value && is_cheap_check<Separator>::value>;
+    using commits = any_true<has_commit<Subject>::value, has_commit<Separator>::value>;
 
 public:
 
     using plus<Subject>::subject;
+    using plus<Subject>::operator();
+
+    constexpr Separator const & separator() const {return m_separator;}
 
-    constexpr list(Subject sub, Separator sep) : plus<Subject>(std::move(sub)), separator(std::move(sep)) {}
+    constexpr list(Subject sub, Separator sep) : plus<Subject>(std::move(sub)), m_separator(std::move(sep)) {}
 
-    template <class Tag, class Window, int_if<is_check<Tag>> = 0>
-    auto check(Tag tag, Window &w) const {
-        container_type<decltype(check(tag, subject(), w))> ret;
+    template <class Tag, class Window, int_if<is_check<Tag> && !is_cheap_list::value && !commits::value> = 0>
+    auto operator()(Tag tag, Window &w) const {
+        check_container_type<decltype(check(tag, subject(), w))> ret;
         append(ret, check(tag, subject(), w));
-        while (valid(separator, check(tag, separator, w)) && valid(subject(), ret.back()))
+        if (!valid(subject(), ret.back())) {ret.pop_back(); return ret;}
+        // A separator which is not followed by an element is left unmatched
+        for (auto save = w; valid(separator(), check(tag, separator(), w)); save = w) {
             append(ret, check(tag, subject(), w));
-        ret.pop_back();
+            if (!valid(subject(), ret.back())) {ret.pop_back(); w = save; break;}
+        }
+        return ret;
+    }
+
+    template <class Tag, class Window, int_if<is_check<Tag> && is_cheap_list::value && !commits::value> = 0>
+    auto operator()(Tag tag, Window &w) const {
+        repeat_span<Window> ret{w, 0};
+        if (!valid(subject(), check(tag, subject(), w))) return ret;
+        ++ret.count;
+        for (auto save = w; valid(separator(), check(tag, separator(), w)); save = w) {
+            if (!valid(subject(), check(tag, subject(), w))) {w = save; break;}
+            ++ret.count;
+        }
+        return ret;
+    }
+
+    // As for kleene, elements which commit are parsed straight away
+    template <class Tag, class Window, int_if<is_check<Tag> && commits::value> = 0>
+    auto operator()(Tag, Window &w) const {
+        auto r = (*this)(fused_c, w);
+        return make_parsed_repeat(r ? std::move(*r) : std::decay_t<decltype(*r)>());
+    }
+
+    // The separators are checked again between the elements
+    template <class Tag, class Window, int_if<is_parse<Tag>> = 0>
+    auto operator()(Tag tag, repeat_span<Window> data) const {
+        container_type<decltype(parse(tag, subject(), check(check_c, subject(), *data.begin)))> ret;
+        ret.reserve(data.count);
+        for (; data.count; --data.count) {
+            append(ret, parse(tag, subject(), check(check_c, subject(), *data.begin)));
+            if (data.count != 1) check(check_c, separator(), *data.begin);
+        }
+        return ret;
+    }
+
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {
+        if (!recognize(subject(), w)) return false;
+        for (auto save = w; recognize(separator(), w); save = w)
+            if (!recognize(subject(), w)) {w = save; break;}
+        return true;
+    }
+
+    template <class Window>
+    auto operator()(fused_t, Window &w) const {
+        optional_type<container_type<typename decltype(fused(subject(), w))::value_type>> ret;
+        auto t = fused(subject(), w);
+        if (!t) return ret;
+        ret.emplace();
+        append(*ret, std::move(*t));
+        for (auto save = w; recognize(separator(), w); save = w) {
+            if (!(t = fused(subject(), w))) {w = save; break;}
+            append(*ret, std::move(*t));
+        }
         return ret;
     }
 };
@@ -19,12 +19,25 @@ public:
     template <class Data>
     auto operator()(valid_t, Data const &data) const {return hana::true_c;}
 
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {return recognize(subject, w) || true;}
+
+    template <class Window>
+    auto operator()(fused_t, Window &w) const {
+        optional_type<decltype(fused(subject, w))> ret;
+        ret.emplace(fused(subject, w));
+        return ret;
+    }
+
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag tag, Data &&data) const {
         optional_type<decltype(parse(tag, subject, std::forward<Data>(data)))> ret;
         if (valid(subject, data)) ret = parse(tag, subject, std::forward<Data>(data));
         return ret;
     }
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, subject).with_nullable(true);}
 };
 
 /******************************************************************************************/
@@ -33,7 +46,7 @@ template <class T> struct is_optional : std::false_type {};
 template <class T> struct is_optional<optional<T>> : std::true_type {};
 
 template <class Subject, int_if<is_expression<Subject>> = 0>
-auto operator~(Subject const &subject) {return optional<Subject>(subject);}
+constexpr auto operator~(Subject const &subject) {return optional<Subject>(subject);}
 
 /******************************************************************************************/
 
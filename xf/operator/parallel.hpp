@@ -0,0 +1,163 @@
+#pragma once
+#include "list.hpp"
+
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Thrown when input parsed as a whole does not all match, with the offset at which matching stopped
+struct parse_error : std::runtime_error {
+    std::size_t position;
+    explicit parse_error(std::size_t p) : std::runtime_error("parsing failed at position " + std::to_string(p)), position(p) {}
+};
+
+/******************************************************************************************/
+
+namespace detail {
+
+// Parses a list from one chunk start up to the start of the next, one element at a time
+template <class Subject, class Separator, class Masks, class Iterator>
+class list_chunker {
+    Subject const &subject;
+    Separator const &separator;
+    Masks const &masks;
+    Iterator m_end;
+
+public:
+
+    auto at(Iterator b) const {return with_masks(window<Iterator, hana::equal_t>(hana::equal, b, m_end), masks);}
+
+    using window_type = decltype(std::declval<list_chunker const &>().at(std::declval<Iterator>()));
+    using value_type = decltype(parse(parse_c, std::declval<Subject const &>(), check(check_c, std::declval<Subject const &>(), std::declval<window_type &>())));
+
+    enum status {joined, ended, lost};
+
+    struct chunk {
+        container_type<value_type> values;
+        Iterator begin, end;   // where the chunk started and where its last element ended
+        status how = ended;
+        std::exception_ptr error;
+    };
+
+    list_chunker(Subject const &s, Separator const &p, Masks const &m, Iterator e) : subject(s), separator(p), masks(m), m_end(e) {}
+
+    // Each element is checked and parsed on its own, so its check data never outlives it
+    bool element(window_type &w, container_type<value_type> &out) const {
+        arena memory;
+        arena_scope scope(&memory);
+        memo_table memo;
+        memo_scope memo_scope(&memo);
+        auto save = w;
+        auto data = check(check_c, subject, w);
+        if (!valid(subject, data)) {w = save; return false;}
+        arena_scope heap(nullptr);
+        append(out, parse(parse_c, subject, std::move(data)));
+        return true;
+    }
+
+    // Run from b, which is either a chunk start or just after an element, until the list ends or reaches stop
+    // Joined: a separator ended exactly at stop, which is where the next chunk's parse began
+    // Lost: the list went past stop without touching it, so the next chunk began in the wrong place
+    chunk run(Iterator b, Iterator stop, bool after_element) const {
+        chunk c;
+        c.begin = b;
+        try {
+            auto w = at(b);
+            if (!after_element && !element(w, c.values)) {c.end = w.begin(); return c;}
+            while (true) {
+                auto save = w;
+                if (!valid(separator, check(check_c, separator, w))) {w = save; break;}
+                if (stop != m_end && w.begin() == stop) {w = save; c.how = joined; break;}
+                if (stop != m_end && std::distance(stop, w.begin()) > 0) {w = save; c.how = lost; break;}
+                if (!element(w, c.values)) {w = save; break;}
+                if (stop != m_end && std::distance(stop, w.begin()) >= 0) {c.how = lost; break;}
+            }
+            c.end = w.begin();
+        } catch (...) {
+            c.error = std::current_exception();
+        }
+        return c;
+    }
+
+    // First place at or after b which a separator ends at, or the end
+    Iterator boundary(Iterator b) const {
+        auto const f = first(separator);
+        for (; b != m_end; ++b) {
+            if (!f.nullable() && sizeof(*b) == 1 && !f.contains(static_cast<unsigned char>(*b))) continue;
+            auto w = at(b);
+            if (valid(separator, check(check_c, separator, w))) return w.begin();
+        }
+        return m_end;
+    }
+};
+
+}
+
+/******************************************************************************************/
+
+// The same result as parsing the whole input with the list and requiring it all to match
+// The input is cut at separators into a chunk per thread, which are checked and parsed at once
+// Every chunk boundary is confirmed by the chunk before it reaching it exactly; where that fails
+// the list is carried on from where it really was, so grammars whose elements may contain the
+// separator still come out right, only slower
+template <class Subject, class Separator, class ...Masks, class V>
+auto parse_parallel(list<Subject, Separator> const &l, hana::tuple<Masks...> const &masks, V const &v, std::size_t threads) {
+    using iterator = std::decay_t<decltype(v.begin())>;
+    static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<iterator>::iterator_category>::value,
+        "Parallel parsing needs random access input");
+    using chunker = detail::list_chunker<Subject, Separator, hana::tuple<Masks...>, iterator>;
+
+    auto const b = v.begin(), e = v.end();
+    chunker const c(l.subject(), l.separator(), masks, e);
+    std::size_t const size = e - b;
+    if (threads < 1) threads = 1;
+
+    // Chunk starts: the input start, then the end of the first separator after each even split
+    std::vector<iterator> starts{c.at(b).begin()};
+    for (std::size_t i = 1; i < threads; ++i) {
+        auto const s = c.boundary(b + size * i / threads);
+        if (s != e && std::distance(starts.back(), s) > 0) starts.push_back(s);
+    }
+    auto const stop = [&](std::size_t i) {return i + 1 < starts.size() ? starts[i + 1] : e;};
+
+    std::vector<typename chunker::chunk> chunks(starts.size());
+    std::vector<std::thread> pool;
+    for (std::size_t i = 1; i < starts.size(); ++i)
+        pool.emplace_back([&, i] {chunks[i] = c.run(starts[i], stop(i), false);});
+    chunks[0] = c.run(starts[0], stop(0), false);
+    for (auto &t : pool) t.join();
+
+    // Stitch the chunks together in order, redoing any stretch that a chunk boundary got wrong
+    container_type<typename chunker::value_type> out;
+    std::size_t i = 0;
+    auto chunk = std::move(chunks[0]);
+    while (true) {
+        if (chunk.error) std::rethrow_exception(chunk.error);
+        if (out.empty()) out = std::move(chunk.values);
+        else for (auto &x : chunk.values) append(out, std::move(x));
+        if (chunk.how == chunker::joined) {
+            // If no element follows the separator after all, the list ended before it
+            auto const end = chunk.end;
+            chunk = std::move(chunks[++i]);
+            if (chunk.values.empty() && chunk.how == chunker::ended) chunk.end = end;
+            continue;
+        }
+        if (chunk.how == chunker::ended) break;
+        while (i + 1 < starts.size() && std::distance(starts[i + 1], chunk.end) >= 0) ++i;
+        chunk = c.run(chunk.end, stop(i), true);
+    }
+
+    if (out.empty() || c.at(chunk.end)) throw parse_error(c.at(chunk.end).begin() - b);
+    return out;
+}
+
+/******************************************************************************************/
+
+}
@@ -11,6 +11,8 @@ class plus : kleene<Subject> {
 
 public:
 
+    using kleene<Subject>::subject;
+
     template <class ...Ts>
     explicit constexpr plus(Ts &&...ts) : kleene<Subject>(std::forward<Ts>(ts)...) {}
 
@@ -20,9 +22,22 @@ public:
     template <class Data>
     auto operator()(valid_t, Data const &data) const {return !data.empty();}
 
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {return recognize(this->subject(), w) && base()(recognize_c, w);}
+
+    template <class Window>
+    auto operator()(fused_t, Window &w) const {
+        auto ret = base()(fused_c, w);
+        if (ret->empty()) ret.reset();
+        return ret;
+    }
+
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag tag, Data &&data) const {return parse(tag, base(), std::forward<Data>(data));}
 
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, this->subject());}
+
 };
 
 /******************************************************************************************/
@@ -19,7 +19,7 @@ struct restriction : parser_base {
     template <class Tag, class Window, int_if<is_check<Tag>> = 0>
     auto operator()(Tag tag, Window &w) const {
         auto w_mod = w;
-        auto ok = hana::none_of(fails, [&](auto const &f) {return valid(f, check(f, w_mod));});
+        auto ok = hana::none_of(fails, [&](auto const &f) {return valid(f, check(check_c, f, w_mod));});
         optional_type<decltype(check(tag, subject, w))> ret;
         if (!ok) return ret;
         ret.emplace(check(tag, subject, w));
@@ -31,6 +31,9 @@ struct restriction : parser_base {
     decltype(auto) operator()(Tag tag, Data data) const {
         return parse(tag, subject, std::move(*data));
     }
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first(f, subject);}
 };
 
 /******************************************************************************************/
@@ -5,6 +5,7 @@
 
 #include <boost/hana/back.hpp>
 #include <boost/hana/append.hpp>
+#include <boost/hana/all_of.hpp>
 
 namespace xf {
 
@@ -20,9 +21,17 @@ class sequence : public parser_base {
         return optional_c(tuple_c(hana::transform(m_parsers, f)));
     }
 
+    // Stops at the first element which can't be skipped, so later ones (and their rules) aren't visited
+    template <class F, std::size_t ...Is>
+    constexpr first_set first_then(F f, std::index_sequence<Is...>) const {
+        first_set s(true);
+        bool _[] = {true, (s = s.nullable() ? s.then(first(f, hana::at_c<Is>(m_parsers))) : s, true)...};
+        return (void) _, s;
+    }
+
 public:
 
-    auto const & parsers() const {return m_parsers;}
+    constexpr auto const & parsers() const {return m_parsers;}
 
     constexpr sequence(hana::tuple<Parsers...> tuple) : m_parsers(std::move(tuple)) {}
 
@@ -31,21 +40,65 @@ public:
         decltype(*check_type(tag, w)) ret;
         bool good = true;
         auto save = w;
-        ret = hana::transform(m_parsers, [&](auto const &p) {
+        auto step = [&](auto const &p) {
             decltype(check(tag, p, w)) t;
             if (good) good = valid(p, t = check(tag, p, w));
             return t;
+        };
+        // braced initialization keeps the checks in left-to-right order
+        ret = hana::unpack(m_parsers, [&](auto const &...ps) {
+            return hana::tuple<decltype(check(tag, ps, w))...>{step(ps)...};
         });
         if (!good) {ret.reset(); w = save;}
         return ret;
     }
 
+    // In order as well, since parsing a commit releases the input before it
     template <class T, class Data, int_if<is_parse<T>> = 0>
     auto operator()(T tag, Data &&data) const {
-        return hana::transform(indices_c<sizeof...(Parsers)>, [&] (auto i) {
-            return parse(tag, m_parsers[i], std::move((*data)[i]));
+        return hana::unpack(indices_c<sizeof...(Parsers)>, [&](auto ...is) {
+            return hana::tuple<decltype(parse(tag, m_parsers[is], std::move((*data)[is])))...>{parse(tag, m_parsers[is], std::move((*data)[is]))...};
         });
     }
+
+    template <class Window>
+    bool operator()(recognize_t, Window &w) const {
+        auto save = w;
+        bool good = hana::all_of(m_parsers, [&](auto const &p) {return recognize(p, w);});
+        if (!good) w = save;
+        return good;
+    }
+
+    // Whether the sequence can still fail once its first element has matched
+    template <class Window>
+    static constexpr bool fails_after_first() {
+        bool const fails[] = {can_fail<Parsers, Window>...};
+        for (std::size_t i = 1; i != sizeof...(Parsers); ++i) if (fails[i]) return true;
+        return false;
+    }
+
+    // Only fused if nothing built for the first element can be thrown away, otherwise checked then parsed
+    template <class Tag, class Window, int_if<std::is_same<Tag, fused_t>::value> = 0, int_if<!fails_after_first<Window>()> = 0>
+    auto operator()(Tag, Window &w) const {
+        bool good = true;
+        auto save = w;
+        auto step = [&](auto const &p) {
+            decltype(fused(p, w)) t;
+            if (good) good = bool(t = fused(p, w));
+            return t;
+        };
+        auto ts = hana::unpack(m_parsers, [&](auto const &...ps) {
+            return hana::tuple<decltype(fused(ps, w))...>{step(ps)...};
+        });
+        auto values = [](auto &&...ts) {return hana::make_tuple(std::move(*ts)...);};
+        optional_type<decltype(hana::unpack(std::move(ts), values))> ret;
+        if (good) ret.emplace(hana::unpack(std::move(ts), values));
+        else w = save;
+        return ret;
+    }
+
+    template <class F, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f) const {return first_then(f, std::index_sequence_for<Parsers...>());}
 };
 
 static constexpr auto sequence_c = hana::fuse(hana::template_<sequence>);
@@ -87,6 +140,11 @@ struct apply_t<sequence<Parsers...>, void> {
             return parse(tag, s.parsers()[i], std::move((*data)[i]));
         }), op);
     }
+
+    template <class Attribute, class Operation>
+    auto operator()(fused_t, sequence<Parsers...> const &, Operation const &op, Attribute &&a) {
+        return hana::unpack(std::forward<Attribute>(a), op);
+    }
 };
 
 /******************************************************************************************/
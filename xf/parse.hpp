@@ -1,3 +1,4 @@
 #include "parse/declare.hpp"
 #include "parse/parse.hpp"
 #include "parse/window.hpp"
+#include "parse/stream.hpp"
@@ -1,5 +1,7 @@
 #pragma once
 #include "parse.hpp"
+#include "../support/profile.hpp"
+#include <typeinfo>
 
 namespace xf {
 
@@ -16,6 +18,10 @@ template <class T> static constexpr auto declaration_c = declaration_t<T>();
 
 void implement(...);
 
+// Name of a rule in profiles; XF_DEFINE gives its own, otherwise it is the mangled type name
+template <class P>
+char const * rule_name(P const &) {return typeid(P).name();}
+
 template <class P, class=void> struct has_adl_impl : std::false_type {};
 template <class P> struct has_adl_impl<P, void_if<!(std::is_same<decltype(implement(std::declval<P const>())), void>::value)>> : std::true_type {};
 
@@ -24,16 +30,43 @@ template <class P> struct has_member_impl<P, void_if<!(std::is_same<decltype(std
 
 /******************************************************************************************/
 
+// Rules may be recursive: one which is already being followed further up counts as unknown
+template <class P, class F>
+first_set guarded_first(F const &follow) {
+    static thread_local bool active = false;
+    if (active) return first_set::unknown();
+    active = true;
+    auto const s = follow();
+    active = false;
+    return s;
+}
+
+/******************************************************************************************/
+
 template <class P>
 struct implementation<P, void_if<has_adl_impl<P>::value && !has_member_impl<P>::value>> {
     template <class Tag, class Window, int_if<is_check<Tag>> = 0>
-    constexpr auto operator()(Tag tag, P const &p, Window &w) const {return check(tag, implement(p), w);}
+    auto operator()(Tag tag, P const &p, Window &w) const {
+        auto const name = rule_name(p);
+        return profiled(tag, name, 0, name, w, [&] {return check(tag, implement(p), w);}, [&](auto const &d) {return valid(implement(p), d);});
+    }
+
+    template <class Window>
+    auto operator()(fused_t, P const &p, Window &w) const {return fused(implement(p), w);}
+
+    template <class Window>
+    bool operator()(recognize_t, P const &p, Window &w) const {return recognize(implement(p), w);}
 
     template <class Data>
     constexpr auto operator()(valid_t, P const &p, Data const &data) const {return valid(implement(p), data);}
 
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     constexpr auto operator()(Tag tag, P const &p, Data &&data) const {return parse(tag, implement(p), std::forward<Data>(data));}
+
+    // Rule bodies aren't constant expressions, so only rule_first_t looks into them
+    constexpr first_set operator()(first_t, P const &) const {return first_set::unknown();}
+
+    first_set operator()(rule_first_t, P const &p) const {return guarded_first<P>([&] {return first(rule_first_c, implement(p));});}
 };
 
 /******************************************************************************************/
@@ -41,13 +74,26 @@ struct implementation<P, void_if<has_adl_impl<P>::value && !has_member_impl<P>::
 template <class P>
 struct implementation<P, void_if<has_member_impl<P>::value>> {
     template <class Tag, class Window, int_if<is_check<Tag>> = 0>
-    constexpr auto operator()(Tag tag, P const &p, Window &w) const {return check(tag, p.implement(), w);}
+    auto operator()(Tag tag, P const &p, Window &w) const {
+        auto const name = rule_name(p);
+        return profiled(tag, name, 0, name, w, [&] {return check(tag, p.implement(), w);}, [&](auto const &d) {return valid(p.implement(), d);});
+    }
+
+    template <class Window>
+    auto operator()(fused_t, P const &p, Window &w) const {return fused(p.implement(), w);}
+
+    template <class Window>
+    bool operator()(recognize_t, P const &p, Window &w) const {return recognize(p.implement(), w);}
 
     template <class Data>
     constexpr auto operator()(valid_t, P const &p, Data const &data) const {return valid(p.implement(), data);}
 
     template <class Tag, class Data, int_if<is_parse<Tag>> = 0>
     constexpr auto operator()(Tag tag, P const &p, Data &&data) const {return parse(tag, p.implement(), std::forward<Data>(data));}
+
+    constexpr first_set operator()(first_t, P const &) const {return first_set::unknown();}
+
+    first_set operator()(rule_first_t, P const &p) const {return guarded_first<P>([&] {return first(rule_first_c, p.implement());});}
 };
 
 /******************************************************************************************/
@@ -57,7 +103,8 @@ struct implementation<P, void_if<has_member_impl<P>::value>> {
 #define XF_DEFINE(NAME) \
 template <class T> struct implementation; \
 template <> struct implementation<std::decay_t<decltype(NAME)>> {template <bool=true> static constexpr bool value = false;}; \
-template <bool B=true> constexpr auto implement(std::decay_t<decltype(NAME)>) {return implementation<std::decay_t<decltype(NAME)>>::value<B>;} \
+template <bool B=true> constexpr auto const & implement(std::decay_t<decltype(NAME)>) {return implementation<std::decay_t<decltype(NAME)>>::value<B>;} \
+inline char const * rule_name(std::decay_t<decltype(NAME)>) {return #NAME;} \
 template <> auto const implementation<std::decay_t<decltype(NAME)>>::value<>
 
 }
@@ -0,0 +1,90 @@
+#pragma once
+#include "../support/common.hpp"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace xf {
+
+/******************************************************************************************/
+
+struct first_t {};
+
+static constexpr auto first_c = first_t();
+
+// Like first_t, but also follows rules into their bodies, so it only works at run time
+struct rule_first_t : first_t {};
+
+static constexpr auto rule_first_c = rule_first_t();
+
+template <class T>
+static constexpr bool is_first = std::is_base_of<first_t, T>::value;
+
+/******************************************************************************************/
+
+// Conservative set of the 8-bit characters a parser can start with
+// A nullable parser can also succeed without consuming anything, so it must always be tried
+class first_set {
+    std::uint64_t m_bits[4];
+    bool m_nullable;
+
+public:
+
+    constexpr explicit first_set(bool nullable=false) : m_bits{0, 0, 0, 0}, m_nullable(nullable) {}
+
+    // Nothing is known about the parser: it has to be tried everywhere
+    static constexpr first_set unknown() {
+        first_set s(true);
+        for (int i = 0; i != 4; ++i) s.m_bits[i] = ~std::uint64_t(0);
+        return s;
+    }
+
+    constexpr bool nullable() const {return m_nullable;}
+
+    constexpr bool contains(unsigned char c) const {return (m_bits[c / 64] >> (c % 64)) & 1;}
+
+    constexpr first_set & insert(unsigned char c) {m_bits[c / 64] |= std::uint64_t(1) << (c % 64); return *this;}
+
+    constexpr first_set & insert(unsigned char lo, unsigned char hi) {
+        for (unsigned c = lo; c <= hi; ++c) insert(static_cast<unsigned char>(c));
+        return *this;
+    }
+
+    // Wider character types can't be represented, so they give up
+    template <class T>
+    constexpr first_set & insert_char(T c) {
+        if (sizeof(T) == 1) return insert(static_cast<unsigned char>(c));
+        return *this = unknown();
+    }
+
+    constexpr first_set operator|(first_set const &other) const {
+        first_set s(m_nullable || other.m_nullable);
+        for (int i = 0; i != 4; ++i) s.m_bits[i] = m_bits[i] | other.m_bits[i];
+        return s;
+    }
+
+    // First set of this parser followed by the next one
+    constexpr first_set then(first_set const &next) const {
+        if (!m_nullable) return *this;
+        auto s = *this | next;
+        s.m_nullable = next.m_nullable;
+        return s;
+    }
+
+    constexpr first_set with_nullable(bool b) const {auto s = *this; s.m_nullable = b; return s;}
+};
+
+/******************************************************************************************/
+
+// Build a first set from a predicate evaluated on the 7-bit range
+// Anything above 0x7F depends on the locale so it is always included
+template <class F>
+constexpr first_set ascii_first_set(F const &f) {
+    first_set s;
+    for (unsigned c = 0; c != 0x80; ++c) if (f(c)) s.insert(static_cast<unsigned char>(c));
+    return s.insert(0x80, 0xFF);
+}
+
+/******************************************************************************************/
+
+}
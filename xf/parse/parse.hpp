@@ -1,10 +1,16 @@
 #pragma once
 #include "window.hpp"
+#include "first.hpp"
 #include "../support/counter.hpp"
+#include "../support/arena.hpp"
+#include "../support/memo.hpp"
+#include "../support/profile.hpp"
+#include "../support/session.hpp"
 #include <boost/hana/type.hpp>
 #include <boost/hana/functional/overload_linearly.hpp>
 
 #include <stdexcept>
+#include <thread>
 
 namespace xf {
 namespace hana = boost::hana;
@@ -15,8 +21,19 @@ struct valid_t {};
 
 static constexpr auto valid_c = valid_t();
 
+// Check and parse in one step, yielding an optional attribute
+struct fused_t {};
+
+static constexpr auto fused_c = fused_t();
+
+// Check without keeping any data, only whether the parser matched
+struct recognize_t {};
+
+static constexpr auto recognize_c = recognize_t();
+
 /******************************************************************************************/
 
+
 template <class P, class=void>
 struct implementation {static_assert(P::has_an_implementation, "No implementation found");};
 
@@ -29,6 +46,23 @@ auto check(Tag tag, P const &p, Window &w) {
 template <class P, class Data>
 auto valid(P const &p, Data const &data) {return implementation<P>()(valid_c, p, data);}
 
+// Whether checking a P can come back invalid, going by the type valid() gives for it
+template <class P, class Window>
+static constexpr bool can_fail = !std::is_same<std::decay_t<decltype(valid(std::declval<P const &>(),
+    check(check_c, std::declval<P const &>(), std::declval<Window &>())))>, std::decay_t<decltype(hana::true_c)>>::value;
+
+template <class F, class P, int_if<is_first<F>> = 0>
+constexpr first_set first(F f, P const &p) {return implementation<P>()(f, p);}
+
+template <class P>
+constexpr first_set first(P const &p) {return first(first_c, p);}
+
+template <class P, class Window>
+auto fused(P const &p, Window &w) {return implementation<P>()(fused_c, p, w);}
+
+template <class P, class Window>
+bool recognize(P const &p, Window &w) {return implementation<P>()(recognize_c, p, w);}
+
 template <class Tag, class P, class ...Ts>
 auto parse(Tag tag, P const &p, Ts &&...ts) {
     static_assert(is_parse<Tag>, "Should be parsing tag");
@@ -51,6 +85,45 @@ struct implementation<T, void_if<is_parser<T>>> {
 
     template <class Tag, class Parser, class Data, int_if<is_parse<Tag>> = 0>
     auto operator()(Tag tag, Parser const &p, Data &&d) const {return p(tag, std::forward<Data>(d));}
+
+    template <class F, class Parser, int_if<is_first<F>> = 0>
+    constexpr first_set operator()(F f, Parser const &p) const {return first_of(f, p, 0);}
+
+    template <class Parser, class Window>
+    auto operator()(fused_t, Parser const &p, Window &w) const {return fused_of(p, w, 0);}
+
+    template <class Parser, class Window>
+    bool operator()(recognize_t, Parser const &p, Window &w) const {return recognize_of(p, w, 0);}
+
+private:
+
+    template <class Parser, class Window>
+    static auto recognize_of(Parser const &p, Window &w, int) -> decltype(p(recognize_c, w)) {return p(recognize_c, w);}
+
+    template <class Parser, class Window>
+    static bool recognize_of(Parser const &p, Window &w, long) {return bool(valid(p, check(check_c, p, w)));}
+
+    template <class Parser, class Window>
+    static auto fused_of(Parser const &p, Window &w, int) -> decltype(p(fused_c, w)) {return p(fused_c, w);}
+
+    // Otherwise check the subtree and parse it straight away, so its data never outlives this call
+    // The attribute is returned, so it must not come from the check arena
+    template <class Parser, class Window>
+    static auto fused_of(Parser const &p, Window &w, long) {
+        auto data = check(check_c, p, w);
+        optional_type<decltype(parse(parse_c, p, std::move(data)))> ret;
+        if (valid(p, data)) {
+            arena_scope scope(nullptr);
+            ret.emplace(parse(parse_c, p, std::move(data)));
+        }
+        return ret;
+    }
+
+    template <class F, class Parser>
+    static constexpr auto first_of(F f, Parser const &p, int) -> decltype(p(f)) {return p(f);}
+
+    template <class F, class Parser>
+    static constexpr first_set first_of(F, Parser const &, long) {return first_set::unknown();}
 };
 
 /******************************************************************************************/
@@ -59,24 +132,102 @@ template <class Subject, class ...Masks>
 class parser_t {
     Subject subject;
     hana::tuple<Masks...> masks;
+
+    // Check data lives in the arena, which has to outlive it; the parsed result does not
+    // Memoized results live in the memo table until the check is done
+    template <class Window, class Tag=check_map<>>
+    auto check_in(arena &memory, memo_table &memo, Window &w, Tag tag=check_c) const {
+        arena_scope scope(&memory);
+        memo_scope memo_scope(&memo);
+        return check(tag, subject, w);
+    }
+
+    template <class Window, class Tag=check_map<>>
+    auto check_in(arena &memory, Window &w, Tag tag=check_c) const {
+        memo_table memo;
+        return check_in(memory, memo, w, tag);
+    }
+
+    // Check with the storage of s and parse if that matched
+    template <class V>
+    auto parse_in(session &s, V const &v) const {
+        s.begin();
+        auto window = with_masks(make_window(v), masks);
+        auto data = check_in(s.memory(), s.memo(), window);
+        s.end();
+        optional_type<decltype(parse(parse_c, subject, std::move(data)))> ret;
+        if (valid(subject, data)) ret.emplace(parse(parse_c, subject, std::move(data)));
+        return ret;
+    }
+
 public:
 
     constexpr explicit parser_t(Subject s, Masks ...ms) : subject(std::move(s)), masks(std::move(ms)...) {}
 
     template <class V>
     auto match(V const &v) const {
+        arena memory;
         auto window = with_masks(make_window(v), masks);
-        auto data = check(check_c, subject, window);
+        auto data = check_in(memory, window);
         return valid(subject, data);
     }
 
     template <class V, class ...Ts>
     decltype(auto) operator()(V const &v, Ts &&...ts) const {
+        arena memory;
         auto window = with_masks(make_window(v), masks);
-        auto data = check(check_c, subject, window);
+        auto data = check_in(memory, window);
         if (!valid(subject, data)) throw std::runtime_error("parsing failed");
         return parse(parse_c, subject, std::move(data));
     }
+
+    // As operator(), keeping the check storage in s for the next parse rather than allocating it afresh
+    template <class V>
+    auto operator()(V const &v, session &s) const {
+        auto ret = parse_in(s, v);
+        if (!ret) throw std::runtime_error("parsing failed");
+        return std::move(*ret);
+    }
+
+    // Parse each of a range of inputs in turn with the storage of s, giving an attribute for each or none where it failed
+    template <class R>
+    auto parse_many(R const &inputs, session &s) const {
+        container_type<decltype(parse_in(s, *std::begin(inputs)))> ret;
+        for (auto const &v : inputs) append(ret, parse_in(s, v));
+        return ret;
+    }
+
+    // As operator(), recording each rule and alternative branch which the check goes through in p
+    template <class V>
+    decltype(auto) profile(V const &v, profiler &p) const {
+        arena memory;
+        auto window = with_masks(make_window(v), masks);
+        auto const origin = v.begin();
+        profile_scope<std::decay_t<decltype(origin)>> scope(&p, origin);
+        auto data = check_in(memory, window, profile_c);
+        if (!valid(subject, data)) throw std::runtime_error("parsing failed");
+        return parse(parse_c, subject, std::move(data));
+    }
+
+    // Parse a list on several threads, requiring all of the input to match (see parse_parallel)
+    template <class V>
+    auto parallel(V const &v, std::size_t threads=std::thread::hardware_concurrency()) const {
+        return parse_parallel(subject, masks, v, threads);
+    }
+
+    // Single pass which builds attributes as it goes; only what can fail after matching part of the input
+    // (alternatives, restrictions, sequences whose later elements can fail) is checked before being parsed
+    template <class V>
+    auto fused(V const &v) const {
+        arena memory;
+        arena_scope scope(&memory);
+        memo_table memo;
+        memo_scope memo_scope(&memo);
+        auto window = with_masks(make_window(v), masks);
+        auto ret = xf::fused(subject, window);
+        if (!ret) throw std::runtime_error("parsing failed");
+        return std::move(*ret);
+    }
 };
 
 template <class Subject, class ...Masks>
@@ -92,6 +243,12 @@ struct apply_t {
     auto operator()(Tag tag, Subject const &s, Operation const &op, Data &&data) const {
         return op(parse(tag, s, std::forward<Data>(data)));
     }
+
+    // The attribute has already been parsed
+    template <class Attribute, class Operation>
+    auto operator()(fused_t, Subject const &, Operation const &op, Attribute &&a) const {
+        return op(std::forward<Attribute>(a));
+    }
 };
 
 template <class Subject, class Tag, class Data, class Operation>
@@ -0,0 +1,182 @@
+#pragma once
+#include "parse.hpp"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Thrown when a parser backtracks further than a stream_input keeps
+struct lookback_error : std::out_of_range {
+    explicit lookback_error(std::uint64_t pos) : std::out_of_range("stream position " + std::to_string(pos) + " was released") {}
+};
+
+/******************************************************************************************/
+
+namespace detail {
+
+// Chunks of a stream from the last commit point onwards, read as they are needed
+class stream_state {
+    std::function<std::size_t(char *, std::size_t)> m_read;
+    std::deque<std::vector<char>> m_chunks, m_spare;
+    std::size_t m_chunk_size, m_max_chunks;
+    std::uint64_t m_first = 0; // index of the first chunk held
+    std::uint64_t m_size = 0;  // number of chars read so far
+    std::uint64_t m_start = 0; // last commit point
+    bool m_done = false;
+
+    void drop_front() {
+        m_spare.push_back(std::move(m_chunks.front()));
+        m_chunks.pop_front();
+        ++m_first;
+    }
+
+    bool load() {
+        if (m_done) return false;
+        if (m_chunks.size() == m_max_chunks) drop_front();
+        std::vector<char> c;
+        if (m_spare.empty()) c.resize(m_chunk_size);
+        else {c = std::move(m_spare.back()); m_spare.pop_back();}
+        std::size_t n = 0;
+        while (n != m_chunk_size) {
+            auto const r = m_read(c.data() + n, m_chunk_size - n);
+            if (r == 0) break;
+            n += r;
+        }
+        // Every chunk but the last is full, so positions map straight to chunks
+        if (n != m_chunk_size) m_done = true;
+        if (n == 0) {m_spare.push_back(std::move(c)); return false;}
+        m_chunks.push_back(std::move(c));
+        m_size += n;
+        return true;
+    }
+
+public:
+
+    stream_state(std::function<std::size_t(char *, std::size_t)> read, std::size_t chunk_size, std::size_t max_chunks)
+        : m_read(std::move(read)), m_chunk_size(chunk_size), m_max_chunks(max_chunks < 1 ? 1 : max_chunks) {}
+
+    bool has(std::uint64_t pos) {
+        while (pos >= m_size) if (!load()) return false;
+        return true;
+    }
+
+    char at(std::uint64_t pos) {
+        if (!has(pos)) throw std::out_of_range("stream position past the end");
+        auto const chunk = pos / m_chunk_size;
+        if (chunk < m_first) throw lookback_error(pos);
+        return m_chunks[chunk - m_first][pos % m_chunk_size];
+    }
+
+    // Nothing before pos will be looked at again
+    void commit(std::uint64_t pos) {
+        if (pos <= m_start) return;
+        m_start = pos;
+        while (!m_chunks.empty() && (m_first + 1) * m_chunk_size <= pos) drop_front();
+        if (m_chunks.empty()) m_first = pos / m_chunk_size;
+    }
+
+    std::uint64_t start() const {return m_start;}
+    std::size_t chunks() const {return m_chunks.size();}
+};
+
+}
+
+/******************************************************************************************/
+
+// Multi-pass iterator over a stream_input; the default one is its end
+class stream_iterator {
+    detail::stream_state *m_state = nullptr;
+    std::uint64_t m_pos = std::numeric_limits<std::uint64_t>::max();
+
+    bool at_end() const {return !m_state || !m_state->has(m_pos);}
+
+public:
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = char;
+    using difference_type = std::ptrdiff_t;
+    using pointer = char const *;
+    using reference = char;
+
+    stream_iterator() = default;
+    stream_iterator(detail::stream_state *s, std::uint64_t pos) : m_state(s), m_pos(pos) {}
+
+    char operator*() const {return m_state->at(m_pos);}
+    stream_iterator & operator++() {++m_pos; return *this;}
+    stream_iterator operator++(int) {auto ret = *this; ++m_pos; return ret;}
+
+    std::uint64_t position() const {return m_pos;}
+
+    friend bool operator==(stream_iterator const &a, stream_iterator const &b) {
+        if (a.m_state && b.m_state) return a.m_pos == b.m_pos;
+        return a.at_end() == b.at_end();
+    }
+    friend bool operator!=(stream_iterator const &a, stream_iterator const &b) {return !(a == b);}
+    friend bool operator<(stream_iterator const &a, stream_iterator const &b) {return a.m_pos < b.m_pos;}
+
+    friend void commit_before(stream_iterator const &i) {if (i.m_state) i.m_state->commit(i.m_pos);}
+};
+
+// Iterators over other input keep everything
+template <class Iterator>
+void commit_before(Iterator const &) {}
+
+/******************************************************************************************/
+
+// Input read in chunks from a std::istream or any read function, holding at most max_chunks at once
+// Parsing it starts from the last commit point, so consecutive parses carry on where the last committed
+class stream_input {
+    std::unique_ptr<detail::stream_state> m_state;
+
+public:
+
+    explicit stream_input(std::function<std::size_t(char *, std::size_t)> read, std::size_t chunk_size=1 << 16, std::size_t max_chunks=16)
+        : m_state(std::make_unique<detail::stream_state>(std::move(read), chunk_size, max_chunks)) {}
+
+    explicit stream_input(std::istream &is, std::size_t chunk_size=1 << 16, std::size_t max_chunks=16)
+        : stream_input([&is](char *p, std::size_t n) {return static_cast<std::size_t>(is.read(p, n).gcount());}, chunk_size, max_chunks) {}
+
+    stream_iterator begin() const {return {m_state.get(), m_state->start()};}
+    stream_iterator end() const {return {};}
+
+    std::size_t chunks() const {return m_state->chunks();}
+};
+
+/******************************************************************************************/
+
+// Matches nothing and releases the input before the current position
+// The release waits until the commit is parsed, so whatever comes before it has been parsed by then;
+// repeats whose elements commit parse each one as soon as it is checked (see parsed_repeat)
+struct commit_t : parser_base {
+    constexpr commit_t() {}
+
+    template <class Window>
+    auto operator()(check_base, Window &w) const {return w.begin();}
+
+    template <class Iterator>
+    constexpr auto operator()(valid_t, Iterator const &) const {return hana::true_c;}
+
+    template <class Iterator>
+    auto operator()(parse_base, Iterator const &i) const {commit_before(i); return hana::nothing;}
+
+    constexpr first_set operator()(first_t) const {return first_set(true);}
+};
+
+static constexpr auto commit = commit_t();
+
+template <>
+struct is_commit<commit_t> : std::true_type {};
+
+/******************************************************************************************/
+
+}
@@ -7,7 +7,11 @@
 #include <boost/hana/insert.hpp>
 #include <boost/hana/insert_range.hpp>
 #include <boost/hana/remove_if.hpp>
+#include <iterator>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace xf {
 
@@ -18,6 +22,25 @@ class window;
 
 /******************************************************************************************/
 
+// A mask may skip a whole run of contiguous chars at once:
+// mask(skip_c, char const *begin, char const *end, compare) returns the end of the run
+struct skip_t {};
+
+static constexpr auto skip_c = skip_t();
+
+template <class I>
+static constexpr bool is_contiguous_char = std::is_same<I, char *>::value || std::is_same<I, char const *>::value
+    || std::is_same<I, std::string::iterator>::value || std::is_same<I, std::string::const_iterator>::value
+    || std::is_same<I, std::vector<char>::iterator>::value || std::is_same<I, std::vector<char>::const_iterator>::value;
+
+// Contiguous storage of any 1-byte type, which binary parsers read through a pointer
+template <class I, class T=std::remove_cv_t<typename std::iterator_traits<I>::value_type>>
+static constexpr bool is_contiguous_byte = sizeof(T) == 1 && !std::is_same<T, bool>::value && (is_contiguous_char<I>
+    || std::is_same<I, T *>::value || std::is_same<I, T const *>::value
+    || std::is_same<I, typename std::vector<T>::iterator>::value || std::is_same<I, typename std::vector<T>::const_iterator>::value);
+
+/******************************************************************************************/
+
 template <class Iterator, class Compare>
 class window<Iterator, Compare> {
     Iterator m_begin, m_end;
@@ -59,11 +82,30 @@ template <class Iterator, class Compare, class ...Masks>
 class window : public window<Iterator, Compare> {
     hana::tuple<Masks...> m_masks;
 
+    template <class Mask, class I=Iterator, int_if<is_contiguous_char<I>> = 0>
+    auto skip_run(Mask const &m, int) -> decltype(m(skip_c, std::declval<char const *>(), std::declval<char const *>(), std::declval<Compare const &>()), bool()) {
+        auto const b = this->begin();
+        if (b == this->end()) return false;
+        char const *p = std::addressof(*b);
+        auto const n = m(skip_c, p, p + (this->end() - b), this->compare()) - p;
+        this->set_begin(b + n);
+        return n != 0;
+    }
+
+    template <class Mask>
+    bool skip_run(Mask const &, long) {return false;}
+
     void skip() {
         while (true) {
             bool changed = false;
             hana::for_each(m_masks, [&](auto const &m) {
-                while (valid(m, check(check_c, m, this->base()))) changed = true;
+                // Skip the bulk of a run at once where the mask allows, then let it have the final say
+                while (true) {
+                    bool const run = skip_run(m, 0);
+                    bool const one = valid(m, check(check_c, m, this->base()));
+                    if (run || one) changed = true;
+                    if (!one) break;
+                }
             });
             if (sizeof...(Masks) < 2 || !changed) break;
         }
@@ -92,6 +134,25 @@ static constexpr auto window_c = hana::fuse(hana::template_<window>);
 
 /******************************************************************************************/
 
+template <class W> struct is_unmasked_window : std::false_type {};
+template <class Iterator, class Compare> struct is_unmasked_window<window<Iterator, Compare>> : std::true_type {};
+
+// Consume at once the run of single chars which p matches, if p can skip and nothing is masked between them
+template <class P, class Window, int_if<is_unmasked_window<Window>::value && is_contiguous_char<decltype(std::declval<Window>().begin())>> = 0>
+auto take_run(P const &p, Window &w, int) -> decltype(p(skip_c, std::declval<char const *>(), std::declval<char const *>(), w.compare()), std::size_t()) {
+    auto const b = w.begin();
+    if (b == w.end()) return 0;
+    char const *c = std::addressof(*b);
+    std::size_t const n = p(skip_c, c, c + (w.end() - b), w.compare()) - c;
+    w.set_begin(b + n);
+    return n;
+}
+
+template <class P, class Window>
+std::size_t take_run(P const &, Window &, long) {return 0;}
+
+/******************************************************************************************/
+
 // Add a mask
 template <class Iterator, class Compare, class Mask, class ...Masks>
 auto with_mask(window<Iterator, Compare, Masks...> const &w, Mask &&m) {
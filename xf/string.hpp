@@ -3,3 +3,5 @@
 #include "string/literal_char.hpp"
 #include "string/literal_string.hpp"
 #include "string/window_predicate.hpp"
+#include "string/keywords.hpp"
+#include "string/caseless.hpp"
@@ -0,0 +1,108 @@
+#pragma once
+#include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
+#include "../support/scan.hpp"
+
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// ASCII string matched ignoring case whatever the window's comparison, giving the text as it was written
+// The literal is lowercased when it is made, so contiguous narrow input is compared 32 bytes at a time
+template <std::size_t N>
+class caseless_string : parser_base {
+    static constexpr std::size_t padded = (N / 32 + 1) * 32;
+
+    char m_lower[padded], m_fold[padded]; // fold is 0x20 where the literal has a letter
+
+    template <class Char>
+    bool same(std::size_t i, Char c) const {
+        using U = std::make_unsigned_t<Char>;
+        return static_cast<U>(c) < 0x80 && static_cast<char>(static_cast<char>(c) | m_fold[i]) == m_lower[i];
+    }
+
+    template <class Iterator, int_if<is_contiguous_char<Iterator>> = 0>
+    bool match_at(Iterator &i, Iterator e, int) const {
+        auto const left = static_cast<std::size_t>(e - i);
+        if (left < N) return false;
+        if (N == 0) return true;
+        char const *p = std::addressof(*i);
+        // Too near the end of the input to read a whole padded block there
+        char buf[padded];
+        if (left < padded) {
+            std::memcpy(buf, p, N);
+            std::memset(buf + N, 0, padded - N);
+            p = buf;
+        }
+        if (!folded_equal(p, m_lower, m_fold, N)) return false;
+        i += N;
+        return true;
+    }
+
+    template <class Iterator>
+    bool match_at(Iterator &i, Iterator e, long) const {
+        auto j = i;
+        for (std::size_t k = 0; k != N; ++k, ++j) if (j == e || !same(k, *j)) return false;
+        i = j;
+        return true;
+    }
+
+public:
+
+    constexpr caseless_string(char const *s) : m_lower{}, m_fold{} {
+        for (std::size_t i = 0; i != N; ++i) {
+            if (static_cast<unsigned char>(s[i]) >= 0x80) throw std::invalid_argument("Caseless strings must be ASCII");
+            m_lower[i] = ascii_lower(s[i]);
+            m_fold[i] = m_lower[i] >= 'a' && m_lower[i] <= 'z' ? 0x20 : 0;
+        }
+    }
+
+    static constexpr std::size_t size() {return N;}
+
+    // Return pair(iterator, bool) as literal_string does
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        return w.no_skip([&](auto &w) {
+            auto i = w.begin();
+            auto data = std::make_pair(w.begin(), match_at(i, w.end(), 0));
+            if (data.second) w.set_begin(std::move(i));
+            return data;
+        });
+    }
+
+    template <class Data>
+    constexpr auto operator()(valid_t, Data const &data) const {return data.second;}
+
+    template <class Data>
+    auto operator()(parse_base, Data const &data) const {
+        using char_type = std::decay_t<decltype(*data.first)>;
+        return container_type<char_type>(data.first, std::next(data.first, N));
+    }
+
+    constexpr first_set operator()(first_t) const {
+        if (N == 0) return first_set(true);
+        first_set s;
+        s.insert(static_cast<unsigned char>(m_lower[0]));
+        return s.insert(static_cast<unsigned char>(m_lower[0] & ~m_fold[0]));
+    }
+};
+
+template <std::size_t N>
+struct is_cheap_check<caseless_string<N>> : std::true_type {};
+
+/******************************************************************************************/
+
+// caseless("content-length") matches "Content-Length", "CONTENT-LENGTH" and so on
+template <std::size_t N>
+constexpr auto caseless(char const (&s)[N]) {return caseless_string<N - 1>(s);}
+
+/******************************************************************************************/
+
+}
@@ -1,5 +1,8 @@
 #pragma once
 #include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
+#include "../support/scan.hpp"
 
 namespace xf {
 
@@ -24,8 +27,26 @@ public:
 
     template <class T>
     constexpr auto operator()(parse_base, T t) const {return t;}
+
+    constexpr first_set operator()(first_t) const {return predicate_first(predicate, 0);}
+
+    template <class Compare, class P=Predicate>
+    auto operator()(skip_t, char const *b, char const *e, Compare const &) const -> decltype(skip_run(std::declval<P const &>(), b, e)) {
+        return skip_run(predicate, b, e);
+    }
+
+private:
+
+    template <class P>
+    static constexpr auto predicate_first(P const &p, int) -> decltype(ascii_first(p)) {return ascii_first(p);}
+
+    template <class P>
+    static constexpr first_set predicate_first(P const &, long) {return first_set::unknown();}
 };
 
+template <class Predicate>
+struct is_cheap_check<char_predicate<Predicate>> : std::true_type {};
+
 static constexpr auto char_predicate_c = hana::template_<char_predicate>;
 
 /******************************************************************************************/
@@ -38,20 +59,23 @@ static constexpr auto char_predicate_c = hana::template_<char_predicate>;
     }; \
     static constexpr auto name = name##_t(); \
 
-#define xf_CHAR_PREDICATE(name, chop, wop, op) xf_CHAR_FUNCTOR(name, chop, wop, op) \
+// test is the "C" locale classification of the 7-bit character c, used for first sets
+#define xf_CHAR_PREDICATE(name, chop, wop, op, test) xf_CHAR_FUNCTOR(name, chop, wop, op) \
+    struct name##_ascii_t {constexpr bool operator()(unsigned c) const {return test;}}; \
+    constexpr first_set ascii_first(name##_t) {return ascii_first_set(name##_ascii_t());} \
     static constexpr auto name##_x = char_predicate<name##_t>(name);
 
-    xf_CHAR_PREDICATE(alpha,  std::isalpha,  std::iswalpha,  isalpha);
-    xf_CHAR_PREDICATE(digit,  std::isdigit,  std::iswdigit,  isdigit);
-    xf_CHAR_PREDICATE(xdigit, std::isxdigit, std::iswxdigit, isxdigit);
-    xf_CHAR_PREDICATE(cntrl,  std::iscntrl,  std::iswcntrl,  iscntrl);
-    xf_CHAR_PREDICATE(graph,  std::isgraph,  std::iswgraph,  isgraph);
-    xf_CHAR_PREDICATE(space,  std::isspace,  std::iswspace,  isspace);
-    xf_CHAR_PREDICATE(blank,  std::isblank,  std::iswblank,  isblank);
-    xf_CHAR_PREDICATE(print,  std::isprint,  std::iswprint,  isprint);
-    xf_CHAR_PREDICATE(punct,  std::ispunct,  std::iswpunct,  ispunct);
-    xf_CHAR_PREDICATE(lower,  std::islower,  std::iswlower,  islower);
-    xf_CHAR_PREDICATE(upper,  std::isupper,  std::iswupper,  isupper);
+    xf_CHAR_PREDICATE(alpha,  std::isalpha,  std::iswalpha,  isalpha,  (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+    xf_CHAR_PREDICATE(digit,  std::isdigit,  std::iswdigit,  isdigit,  c >= '0' && c <= '9');
+    xf_CHAR_PREDICATE(xdigit, std::isxdigit, std::iswxdigit, isxdigit, (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F'));
+    xf_CHAR_PREDICATE(cntrl,  std::iscntrl,  std::iswcntrl,  iscntrl,  c < 0x20 || c == 0x7F);
+    xf_CHAR_PREDICATE(graph,  std::isgraph,  std::iswgraph,  isgraph,  c > 0x20 && c < 0x7F);
+    xf_CHAR_PREDICATE(space,  std::isspace,  std::iswspace,  isspace,  c == ' ' || (c >= '\t' && c <= '\r'));
+    xf_CHAR_PREDICATE(blank,  std::isblank,  std::iswblank,  isblank,  c == ' ' || c == '\t');
+    xf_CHAR_PREDICATE(print,  std::isprint,  std::iswprint,  isprint,  c >= 0x20 && c < 0x7F);
+    xf_CHAR_PREDICATE(punct,  std::ispunct,  std::iswpunct,  ispunct,  c > 0x20 && c < 0x7F && !((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')));
+    xf_CHAR_PREDICATE(lower,  std::islower,  std::iswlower,  islower,  c >= 'a' && c <= 'z');
+    xf_CHAR_PREDICATE(upper,  std::isupper,  std::iswupper,  isupper,  c >= 'A' && c <= 'Z');
 
     xf_CHAR_FUNCTOR(to_lower,  std::tolower,  std::towlower, tolower);
     xf_CHAR_FUNCTOR(to_upper,  std::toupper,  std::towupper, toupper);
@@ -59,6 +83,10 @@ static constexpr auto char_predicate_c = hana::template_<char_predicate>;
 #undef xf_CHAR_PREDICATE
 #undef xf_CHAR_FUNCTOR
 
+// Vectorized runs of the "C" locale classes; bytes above 0x7F are left to the predicate itself
+inline char const * skip_run(space_t, char const *b, char const *e) {return skip_space(b, e);}
+inline char const * skip_run(blank_t, char const *b, char const *e) {return skip_blank(b, e);}
+
 static constexpr auto char_x = decltype(*char_predicate_c(type_of(always_true)))(always_true);
 
 /******************************************************************************************/
@@ -1,31 +1,208 @@
 #pragma once
 #include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
+#include "../support/scan.hpp"
 
-#include <boost/hana/none_of.hpp>
+#include <boost/hana/any_of.hpp>
 #include <boost/hana/equal.hpp>
 
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 namespace xf {
 
+/******************************************************************************************/
+
+// Characters lo through hi as an element of a char_set
+template <char Lo, char Hi>
+struct char_range {};
+
+namespace detail {
+
+template <char C>
+constexpr void insert_element(byte_table &t, hana::integral_constant<char, C>) {t.insert(static_cast<unsigned char>(C));}
+
+template <char Lo, char Hi>
+constexpr void insert_element(byte_table &t, char_range<Lo, Hi>) {t.insert(static_cast<unsigned char>(Lo), static_cast<unsigned char>(Hi));}
+
+template <class T, char C>
+constexpr bool element_contains(hana::integral_constant<char, C>, T t) {return t == C;}
+
+template <class T, char Lo, char Hi>
+constexpr bool element_contains(char_range<Lo, Hi>, T t) {return Lo <= t && t <= Hi;}
+
+template <class ...Chars>
+constexpr byte_table make_table() {
+    byte_table t;
+    bool _[] = {true, (insert_element(t, Chars()), true)...};
+    return (void) _, t;
+}
+
+template <class ...Chars>
+static constexpr byte_table char_set_table = make_table<Chars...>();
+
+// Read the next range of a set written as "a-z_": a '-' at either end stands for itself
+template <class Char>
+constexpr bool next_range(Char const *&s, Char &lo, Char &hi) {
+    if (!*s) return false;
+    lo = hi = *s++;
+    if (s[0] == Char('-') && s[1]) {hi = s[1]; s += 2;}
+    return true;
+}
+
+template <class T>
+constexpr auto code_point(T t) {return static_cast<std::make_unsigned_t<T>>(t);}
+
+}
+
+/******************************************************************************************/
+
+// Set of chars and char_ranges known at compile time, tested through a 256-bit table
 template <class ...Chars>
 class char_set : parser_base {
-    hana::tuple<Chars...> set;
+    static constexpr auto const & table() {return detail::char_set_table<Chars...>;}
+
+    // Wider characters outside the table are compared as they were before
+    template <class T, int_if<sizeof(T) == 1> = 0>
+    static constexpr bool contains(T t) {return table().contains(static_cast<unsigned char>(t));}
+
+    template <class T, int_if<sizeof(T) != 1> = 0>
+    static constexpr bool contains(T t) {
+        return detail::code_point(t) < 0x80 ? table().contains(static_cast<unsigned char>(t))
+            : hana::any_of(hana::tuple<Chars...>(), [t](auto c) {return detail::element_contains(c, t);});
+    }
 
 public:
 
+    constexpr char_set() {}
+
     template <class ...Ts>
-    explicit constexpr char_set(Ts &&...ts) : set(std::forward<Ts>(ts)...) {}
+    explicit constexpr char_set(Ts &&...) {}
 
     template <class Window>
     auto operator()(check_base, Window &w) const {
-        if (hana::any_of(set, hana::equal.to(*w))) return *(w++);
+        if (bool(w) && contains(*w)) return *(w++);
         else return static_cast<std::decay_t<decltype(*w)>>(0);
     }
 
     template <class T>
     constexpr auto operator()(parse_base, T t) const {return t;}
+
+    constexpr first_set operator()(first_t) const {
+        first_set s;
+        for (unsigned c = 0; c != 256; ++c) if (table().contains(static_cast<unsigned char>(c))) s.insert(static_cast<unsigned char>(c));
+        return s;
+    }
+
+    template <class Compare>
+    char const * operator()(skip_t, char const *b, char const *e, Compare const &) const {return skip_table(b, e, table());}
 };
 
+template <class ...Chars>
+struct is_cheap_check<char_set<Chars...>> : std::true_type {};
+
 struct eol_t : char_set<hana::char_<'\n'>, hana::char_<'\r'>> {constexpr eol_t() {}};
 static constexpr auto eol = eol_t();
 
+/******************************************************************************************/
+
+// Narrow set given at run time (or in a constant expression) as "a-zA-Z_", held as a 256-bit table
+// Wider characters are looked up by code point, so only those below 256 can match
+class char_table : parser_base {
+    detail::byte_table m_table;
+
+public:
+
+    explicit constexpr char_table(char const *s) : m_table() {
+        char lo = 0, hi = 0;
+        while (detail::next_range(s, lo, hi)) m_table.insert(static_cast<unsigned char>(lo), static_cast<unsigned char>(hi));
+    }
+
+    constexpr bool contains(unsigned char c) const {return m_table.contains(c);}
+
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        if (bool(w) && detail::code_point(*w) < 256 && contains(static_cast<unsigned char>(*w))) return *(w++);
+        else return static_cast<std::decay_t<decltype(*w)>>(0);
+    }
+
+    template <class T>
+    constexpr auto operator()(parse_base, T t) const {return t;}
+
+    constexpr first_set operator()(first_t) const {
+        first_set s;
+        for (unsigned c = 0; c != 256; ++c) if (contains(static_cast<unsigned char>(c))) s.insert(static_cast<unsigned char>(c));
+        return s;
+    }
+
+    template <class Compare>
+    char const * operator()(skip_t, char const *b, char const *e, Compare const &) const {return skip_table(b, e, m_table);}
+};
+
+template <>
+struct is_cheap_check<char_table> : std::true_type {};
+
+/******************************************************************************************/
+
+// Wide set given at run time as U"a-zα-ω": a table below 256 and a binary search over sorted, merged ranges above
+template <class Char>
+class char_ranges : parser_base {
+    detail::byte_table m_table;
+    std::vector<std::pair<Char, Char>> m_ranges;
+
+public:
+
+    explicit char_ranges(Char const *s) {
+        Char lo = 0, hi = 0;
+        while (detail::next_range(s, lo, hi)) {
+            if (hi < lo) continue;
+            for (; detail::code_point(lo) < 256 && lo <= hi; ++lo) {
+                m_table.insert(static_cast<unsigned char>(lo));
+                if (lo == hi) break;
+            }
+            if (detail::code_point(lo) >= 256) m_ranges.emplace_back(lo, hi);
+        }
+        std::sort(m_ranges.begin(), m_ranges.end());
+        std::vector<std::pair<Char, Char>> merged;
+        for (auto const &r : m_ranges) {
+            if (!merged.empty() && detail::code_point(r.first) <= detail::code_point(merged.back().second) + 1)
+                merged.back().second = std::max(merged.back().second, r.second);
+            else merged.push_back(r);
+        }
+        m_ranges = std::move(merged);
+    }
+
+    bool contains(Char c) const {
+        if (detail::code_point(c) < 256) return m_table.contains(static_cast<unsigned char>(c));
+        auto it = std::upper_bound(m_ranges.begin(), m_ranges.end(), c, [](Char c, auto const &r) {return c < r.first;});
+        return it != m_ranges.begin() && c <= std::prev(it)->second;
+    }
+
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        if (bool(w) && contains(static_cast<Char>(*w))) return *(w++);
+        else return static_cast<std::decay_t<decltype(*w)>>(0);
+    }
+
+    template <class T>
+    constexpr auto operator()(parse_base, T t) const {return t;}
+
+    first_set operator()(first_t) const {return first_set::unknown();}
+};
+
+template <class Char>
+struct is_cheap_check<char_ranges<Char>> : std::true_type {};
+
+/******************************************************************************************/
+
+constexpr char_table chars(char const *s) {return char_table(s);}
+inline char_ranges<wchar_t> chars(wchar_t const *s) {return char_ranges<wchar_t>(s);}
+inline char_ranges<char16_t> chars(char16_t const *s) {return char_ranges<char16_t>(s);}
+inline char_ranges<char32_t> chars(char32_t const *s) {return char_ranges<char32_t>(s);}
+
+/******************************************************************************************/
+
 }
@@ -0,0 +1,186 @@
+#pragma once
+#include "../support/common.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
+#include "../support/scan.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+namespace xf {
+
+/******************************************************************************************/
+
+namespace detail {
+
+struct keyword_entry {
+    char const *text;
+    std::size_t size;
+};
+
+constexpr std::size_t keyword_slots(std::size_t n) {
+    std::size_t s = 1;
+    while (s < 2 * n) s *= 2;
+    return s;
+}
+
+// Only the first char, length and last char are hashed, so a lookup never reads past the candidate
+constexpr std::size_t keyword_hash(unsigned char first, std::size_t size, unsigned char last) {
+    return (first * 0x9E37u) ^ (size * 0x85EBu) ^ (last * 0xC2B3u) ^ (last >> 3);
+}
+
+constexpr bool same_text(keyword_entry a, keyword_entry b) {
+    if (a.size != b.size) return false;
+    for (std::size_t i = 0; i != a.size; ++i) if (a.text[i] != b.text[i]) return false;
+    return true;
+}
+
+}
+
+/******************************************************************************************/
+
+// Longest of a fixed set of narrow keywords, giving its index; built entirely at compile time
+// Each length that a keyword starting with the next char has is one probe of an open addressed table
+// Keywords must be 1 to 63 chars long and are compared exactly, without the window's comparison
+template <std::size_t N>
+class keywords_t : parser_base {
+    static constexpr std::size_t slots = detail::keyword_slots(N);
+    static_assert(N < 0xFFFF, "Too many keywords");
+
+    detail::keyword_entry m_words[N];
+    std::uint16_t m_table[slots]; // keyword index + 1, or 0 if empty
+    std::uint64_t m_lengths[256]; // bit n is set if a keyword of length n starts with the char
+    std::size_t m_longest;
+
+    static constexpr unsigned char byte(char c) {return static_cast<unsigned char>(c);}
+
+    template <class Char>
+    static constexpr bool narrow(Char c) {return sizeof(Char) == 1 || static_cast<std::make_unsigned_t<Char>>(c) < 256;}
+
+    template <class Iterator, int_if<is_contiguous_char<Iterator>> = 0>
+    std::size_t find_at(Iterator b, Iterator e, int) const {return b == e ? N : find(std::addressof(*b), e - b);}
+
+    // Look at no more than the longest keyword could need
+    template <class Iterator>
+    std::size_t find_at(Iterator b, Iterator e, long) const {
+        char buf[64];
+        std::size_t n = 0;
+        for (; n != m_longest && b != e && narrow(*b); ++b) buf[n++] = static_cast<char>(*b);
+        return find(buf, n);
+    }
+
+public:
+
+    template <class ...Ts>
+    constexpr keywords_t(Ts const &...ts) : m_words{{ts.text, ts.size}...}, m_table{}, m_lengths{}, m_longest(0) {
+        for (std::size_t i = 0; i != N; ++i) {
+            auto const k = m_words[i];
+            if (k.size == 0 || k.size >= 64) throw std::length_error("Keywords must be 1 to 63 chars long");
+            bool seen = false;
+            for (std::size_t j = 0; j != i; ++j) seen = seen || detail::same_text(m_words[j], k);
+            if (seen) continue; // the first of two equal keywords is the one found
+            auto h = detail::keyword_hash(byte(k.text[0]), k.size, byte(k.text[k.size - 1])) & (slots - 1);
+            while (m_table[h]) h = (h + 1) & (slots - 1);
+            m_table[h] = static_cast<std::uint16_t>(i + 1);
+            m_lengths[byte(k.text[0])] |= std::uint64_t(1) << k.size;
+            if (k.size > m_longest) m_longest = k.size;
+        }
+    }
+
+    static constexpr std::size_t size() {return N;}
+
+    constexpr char const * operator[](std::size_t i) const {return m_words[i].text;}
+
+    // Index of the longest keyword starting at p, or N if there is none
+    std::size_t find(char const *p, std::size_t n) const {
+        if (n == 0) return N;
+        auto lengths = m_lengths[byte(*p)];
+        if (n < 63) lengths &= (std::uint64_t(2) << n) - 1;
+        while (lengths) {
+            auto const size = highest_bit(lengths);
+            lengths &= ~(std::uint64_t(1) << size);
+            for (auto h = detail::keyword_hash(byte(*p), size, byte(p[size - 1])) & (slots - 1); m_table[h]; h = (h + 1) & (slots - 1)) {
+                auto const &k = m_words[m_table[h] - 1];
+                if (k.size == size && std::memcmp(k.text, p, size) == 0) return m_table[h] - 1;
+            }
+        }
+        return N;
+    }
+
+    template <class Window>
+    auto operator()(check_base, Window &w) const {
+        return w.no_skip([&](auto &w) {
+            optional_type<std::size_t> ret;
+            auto it = w.begin();
+            auto const i = find_at(it, w.end(), 0);
+            if (i != N) {
+                std::advance(it, m_words[i].size);
+                w.set_begin(it);
+                ret = i;
+            }
+            return ret;
+        });
+    }
+
+    template <class Data>
+    std::size_t operator()(parse_base, Data const &data) const {return *data;}
+
+    constexpr first_set operator()(first_t) const {
+        first_set s;
+        for (unsigned c = 0; c != 256; ++c) if (m_lengths[c]) s.insert(static_cast<unsigned char>(c));
+        return s;
+    }
+
+    // Give values[i] rather than the index i for the ith keyword
+    template <class ...Ts>
+    constexpr auto map(Ts &&...ts) const;
+};
+
+template <std::size_t N>
+struct is_cheap_check<keywords_t<N>> : std::true_type {};
+
+/******************************************************************************************/
+
+template <std::size_t N, class T>
+class mapped_keywords : parser_base {
+    keywords_t<N> m_keywords;
+    std::array<T, N> m_values;
+
+public:
+
+    constexpr mapped_keywords(keywords_t<N> k, std::array<T, N> v) : m_keywords(k), m_values(std::move(v)) {}
+
+    template <class Tag, class Window, int_if<is_check<Tag>> = 0>
+    auto operator()(Tag tag, Window &w) const {return check(tag, m_keywords, w);}
+
+    template <class Data>
+    T operator()(parse_base, Data const &data) const {return m_values[*data];}
+
+    constexpr first_set operator()(first_t) const {return first(m_keywords);}
+};
+
+template <std::size_t N, class T>
+struct is_cheap_check<mapped_keywords<N, T>> : std::true_type {};
+
+template <std::size_t N>
+template <class ...Ts>
+constexpr auto keywords_t<N>::map(Ts &&...ts) const {
+    static_assert(sizeof...(Ts) == N, "One value is needed for each keyword");
+    using T = std::decay_t<std::common_type_t<Ts...>>;
+    return mapped_keywords<N, T>(*this, std::array<T, N>{{static_cast<T>(std::forward<Ts>(ts))...}});
+}
+
+/******************************************************************************************/
+
+// keywords("if", "else", "elif") matches the longest of them and gives its index
+template <std::size_t ...Ns>
+constexpr auto keywords(char const (&...s)[Ns]) {
+    return keywords_t<sizeof...(Ns)>(detail::keyword_entry{s, Ns - 1}...);
+}
+
+/******************************************************************************************/
+
+}
@@ -1,5 +1,8 @@
 #pragma once
 #include "detail.hpp"
+#include "../parse/first.hpp"
+#include "../parse/window.hpp"
+#include "../support/scan.hpp"
 
 namespace xf {
 
@@ -21,8 +24,16 @@ public:
     constexpr bool operator()(valid_t, T t) const {return bool(t);}
 
     constexpr auto operator()(parse_base, T t) const {return t;}
+
+    constexpr first_set operator()(first_t) const {return first_set().insert_char(m_value);}
+
+    template <class Compare, class U=T, int_if<std::is_same<U, char>::value && std::is_same<Compare, hana::equal_t>::value> = 0>
+    char const * operator()(skip_t, char const *b, char const *e, Compare const &) const {return skip_byte(b, e, m_value);}
 };
 
+template <class T>
+struct is_cheap_check<literal<T>> : std::true_type {};
+
 namespace literals {
     constexpr auto operator""_x(char c) {return literal<char>(c);}
     constexpr auto operator""_x(char16_t c) {return literal<char16_t>(c);}
@@ -1,6 +1,9 @@
 #pragma once
 #include "detail.hpp"
+#include "char_predicate.hpp"
 #include "../support/common.hpp"
+#include "../support/scan.hpp"
+#include "../parse/first.hpp"
 
 namespace xf {
 
@@ -25,13 +28,38 @@ public:
 
     constexpr literal_string(string s) : str(std::move(s)) {}
 
+private:
+
+    // Whether the string starts at i, moving i past it if so
+    template <class Iterator, class Compare>
+    bool match_at(Iterator &i, Iterator e, Compare const &c, long) const {
+        auto its = std::mismatch(std::begin(str), std::end(str), i, e, c);
+        if (its.first != std::end(str)) return false;
+        i = std::move(its.second);
+        return true;
+    }
+
+    // Caseless narrow text goes 16 chars at a time while both sides are ASCII, and through the comparison after
+    template <class Iterator, int_if<is_contiguous_char<Iterator> && std::is_same<char_type, char>::value> = 0>
+    bool match_at(Iterator &i, Iterator e, caseless_compare const &c, int) const {
+        std::size_t const n = detail::string_length(str);
+        if (n == 0) return true;
+        if (static_cast<std::size_t>(e - i) < n) return false;
+        char const *s = std::addressof(*std::begin(str)), *p = std::addressof(*i);
+        for (auto k = ascii_caseless_prefix(s, p, n); k != n; ++k) if (!c(s[k], p[k])) return false;
+        i += n;
+        return true;
+    }
+
+public:
+
     // Return pair(iterator, bool) where bool is the success and iterator is the start of the string
     template <class Window>
     auto operator()(check_base, Window &w) const {
         return w.no_skip([&](auto &w) {
-            auto its = std::mismatch(std::begin(str), std::end(str), w.begin(), w.end(), w.compare());
-            auto data = std::make_pair(w.begin(), std::move(its.first) == std::end(str));
-            if (data.second) w.set_begin(std::move(its.second));
+            auto i = w.begin();
+            auto data = std::make_pair(w.begin(), match_at(i, w.end(), w.compare(), 0));
+            if (data.second) w.set_begin(std::move(i));
             return data;
         });
     }
@@ -43,8 +71,15 @@ public:
     constexpr auto operator()(parse_base, Data const &data) const {
         return container_type<char_type>(data.first, std::next(data.first, detail::string_length(str)));
     }
+
+    constexpr first_set operator()(first_t) const {
+        return str.begin() == str.end() ? first_set(true) : first_set().insert_char(*str.begin());
+    }
 };
 
+template <class String>
+struct is_cheap_check<literal_string<String>> : std::true_type {};
+
 /******************************************************************************************/
 
 namespace literals {
@@ -0,0 +1,171 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Monotonic allocator: memory is only given back all at once when the arena is released
+// Destructors of the objects placed in it are the owner's business
+class arena {
+    struct block {
+        block *next;
+        std::size_t size;
+    };
+
+    block *m_head = nullptr;
+    char *m_pos = nullptr, *m_end = nullptr;
+    std::size_t m_next_size;
+    std::size_t m_allocations = 0, m_blocks = 0, m_used = 0;
+
+    static constexpr std::size_t max_block_size = std::size_t(1) << 20;
+
+    void grow(std::size_t n, std::size_t align) {
+        std::size_t size = m_next_size;
+        while (size < n + align + sizeof(block)) size *= 2;
+        if (m_next_size < max_block_size) m_next_size *= 2;
+        auto b = static_cast<block *>(::operator new(size));
+        b->next = m_head;
+        b->size = size;
+        m_head = b;
+        m_pos = reinterpret_cast<char *>(b + 1);
+        m_end = reinterpret_cast<char *>(b) + size;
+        ++m_blocks;
+    }
+
+public:
+
+    explicit arena(std::size_t initial_size=4096) : m_next_size(initial_size) {}
+
+    arena(arena const &) = delete;
+    arena & operator=(arena const &) = delete;
+
+    ~arena() {release();}
+
+    void * allocate(std::size_t n, std::size_t align) {
+        auto p = (reinterpret_cast<std::uintptr_t>(m_pos) + align - 1) & ~std::uintptr_t(align - 1);
+        if (m_head == nullptr || p + n > reinterpret_cast<std::uintptr_t>(m_end)) {
+            grow(n, align);
+            p = (reinterpret_cast<std::uintptr_t>(m_pos) + align - 1) & ~std::uintptr_t(align - 1);
+        }
+        m_used += p + n - reinterpret_cast<std::uintptr_t>(m_pos);
+        m_pos = reinterpret_cast<char *>(p + n);
+        ++m_allocations;
+        return reinterpret_cast<void *>(p);
+    }
+
+    // Free every block; anything still living in the arena is invalidated
+    void release() {
+        while (m_head) {
+            auto next = m_head->next;
+            ::operator delete(m_head);
+            m_head = next;
+        }
+        m_pos = m_end = nullptr;
+    }
+
+    // Free every block but the largest, and hand that out again from its start
+    void reset() {
+        if (!m_head) return;
+        block **largest = &m_head;
+        for (block **b = &m_head; *b; b = &(*b)->next) if ((*b)->size > (*largest)->size) largest = b;
+        auto keep = *largest;
+        *largest = keep->next;
+        release();
+        keep->next = nullptr;
+        m_head = keep;
+        m_pos = reinterpret_cast<char *>(keep + 1);
+        m_end = reinterpret_cast<char *>(keep) + keep->size;
+        m_used = 0;
+    }
+
+    std::size_t allocations() const {return m_allocations;}
+    std::size_t blocks() const {return m_blocks;}
+
+    // Bytes handed out since the arena was made or last reset, counting alignment
+    std::size_t used() const {return m_used;}
+
+    // Blocks a new arena would take from the heap to hand out n bytes, at the least
+    static std::size_t blocks_for(std::size_t n, std::size_t initial_size=4096) {
+        std::size_t blocks = 0, size = initial_size;
+        while (n) {
+            auto const room = size - sizeof(block);
+            n -= n < room ? n : room;
+            ++blocks;
+            if (size < max_block_size) size *= 2;
+        }
+        return blocks;
+    }
+
+    // Arena used by allocations in the current parse on this thread, if any
+    static arena *& current() {
+        static thread_local arena *a = nullptr;
+        return a;
+    }
+};
+
+/******************************************************************************************/
+
+// Allocator for check data: from the arena current when the container is made, otherwise from the heap
+// Deallocating from an arena does nothing; the memory comes back when the arena is reset or released
+template <class T>
+class arena_allocator {
+    template <class U> friend class arena_allocator;
+    arena *m_arena = arena::current();
+
+public:
+
+    using value_type = T;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    arena_allocator() = default;
+
+    template <class U>
+    arena_allocator(arena_allocator<U> const &a) : m_arena(a.m_arena) {}
+
+    T * allocate(std::size_t n) {
+        if (m_arena) return static_cast<T *>(m_arena->allocate(n * sizeof(T), alignof(T)));
+        return std::allocator<T>().allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n) {if (!m_arena) std::allocator<T>().deallocate(p, n);}
+
+    // A copy goes wherever copies are being made, as recursive_wrap's do
+    arena_allocator select_on_container_copy_construction() const {return {};}
+
+    template <class U>
+    bool operator==(arena_allocator<U> const &a) const {return m_arena == a.m_arena;}
+
+    template <class U>
+    bool operator!=(arena_allocator<U> const &a) const {return m_arena != a.m_arena;}
+};
+
+// Container for the check data of repeated elements
+template <class T>
+using check_container_type = std::vector<T, arena_allocator<T>>;
+
+/******************************************************************************************/
+
+// Make an arena current for the lifetime of the scope
+class arena_scope {
+    arena *m_previous;
+
+public:
+
+    explicit arena_scope(arena *a) : m_previous(arena::current()) {arena::current() = a;}
+
+    arena_scope(arena_scope const &) = delete;
+    arena_scope & operator=(arena_scope const &) = delete;
+
+    ~arena_scope() {arena::current() = m_previous;}
+};
+
+/******************************************************************************************/
+
+}
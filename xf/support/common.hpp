@@ -101,6 +101,19 @@ template <class T> static constexpr auto is_expression = hana::bool_c<is_express
 /******************************************************************************************/
 
 struct parser_base : expression_base {constexpr parser_base() {}};
+
+// Parsers whose check data is as cheap to get again by checking as to keep, such as chars and numbers
+template <class P, class=void> struct is_cheap_check : std::false_type {};
+
+// Parsers which release the input behind them (see commit in parse/stream.hpp)
+template <class P> struct is_commit : std::false_type {};
+
+template <bool ...Bs>
+using any_true = std::integral_constant<bool, !std::is_same<std::integer_sequence<bool, false, Bs...>, std::integer_sequence<bool, Bs..., false>>::value>;
+
+// Whether a commit appears anywhere in a parser, going by its type; rule bodies are not looked into
+template <class P> struct has_commit : is_commit<P> {};
+template <template <class...> class T, class ...Ts> struct has_commit<T<Ts...>> : any_true<is_commit<T<Ts...>>::value, has_commit<Ts>::value...> {};
 template <class T, class=void> struct is_parser_t : std::false_type {};
 template <class T> struct is_parser_t<T, std::enable_if_t<std::is_base_of<parser_base, T>::value>> : std::true_type {};
 
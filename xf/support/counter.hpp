@@ -40,6 +40,24 @@ public:
 
     template <class T>
     auto zero(T t) const {return check_map<decltype(base::zero(t))>();}
+
+    // The same kind of tag with nothing counted
+    auto restart() const {return check_map<>();}
+};
+
+// Check tag which also has rules and alternative branches report to the current profiler
+template <class Map=void>
+class profile_map : public check_map<Map> {
+    using base = counter<map_type<Map>>;
+public:
+
+    template <class T>
+    auto plus(T t) const {return profile_map<decltype(base::plus(t))>();}
+
+    template <class T>
+    auto zero(T t) const {return profile_map<decltype(base::zero(t))>();}
+
+    auto restart() const {return profile_map<>();}
 };
 
 template <class T> static constexpr auto is_check = hana::bool_c<std::is_base_of<check_base, T>::value>;
@@ -58,13 +76,20 @@ public:
 
     template <class T>
     auto zero(T t) const {return parse_map<decltype(base::zero(t))>();}
+
+    auto restart() const {return parse_map<>();}
 };
 
 template <class T> static constexpr auto is_parse = hana::bool_c<std::is_base_of<parse_base, T>::value>;
 
+template <class T> struct is_profile_t : std::false_type {};
+template <class Map> struct is_profile_t<profile_map<Map>> : std::true_type {};
+template <class T> static constexpr auto is_profile = hana::bool_c<is_profile_t<T>::value>;
+
 /******************************************************************************************/
 
 static constexpr auto check_c = check_map<>();
 static constexpr auto parse_c = parse_map<>();
+static constexpr auto profile_c = profile_map<>();
 
 }
@@ -0,0 +1,84 @@
+#pragma once
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Results of memoized parsers keyed by (parser id, input position), for one parse
+// When it grows past max_entries everything is dropped and it fills up again
+class memo_table {
+    struct store_base {virtual ~store_base() = default;};
+
+    template <class Key, class Value>
+    struct store : store_base {
+        std::map<Key, Value> map;
+    };
+
+    std::unordered_map<void const *, std::unique_ptr<store_base>> m_stores;
+    std::size_t m_entries = 0, m_max_entries, m_hits = 0, m_misses = 0;
+
+    template <class Key, class Value>
+    auto & map(void const *id) {
+        auto &s = m_stores[id];
+        if (!s) s.reset(new store<Key, Value>);
+        return static_cast<store<Key, Value> &>(*s).map;
+    }
+
+public:
+
+    explicit memo_table(std::size_t max_entries=1 << 16) : m_max_entries(max_entries) {}
+
+    memo_table(memo_table const &) = delete;
+    memo_table & operator=(memo_table const &) = delete;
+
+    template <class Value, class Key>
+    Value const * find(void const *id, Key const &k) {
+        auto &m = map<Key, Value>(id);
+        auto it = m.find(k);
+        if (it == m.end()) {++m_misses; return nullptr;}
+        ++m_hits;
+        return &it->second;
+    }
+
+    template <class Key, class Value>
+    void insert(void const *id, Key const &k, Value &&v) {
+        if (m_entries == m_max_entries) clear();
+        if (map<Key, std::decay_t<Value>>(id).emplace(k, std::forward<Value>(v)).second) ++m_entries;
+    }
+
+    void clear() {m_stores.clear(); m_entries = 0;}
+
+    std::size_t size() const {return m_entries;}
+    std::size_t hits() const {return m_hits;}
+    std::size_t misses() const {return m_misses;}
+
+    // Table used by memoized parsers in the current parse on this thread, if any
+    static memo_table *& current() {
+        static thread_local memo_table *m = nullptr;
+        return m;
+    }
+};
+
+/******************************************************************************************/
+
+// Make a memo table current for the lifetime of the scope
+class memo_scope {
+    memo_table *m_previous;
+
+public:
+
+    explicit memo_scope(memo_table *m) : m_previous(memo_table::current()) {memo_table::current() = m;}
+
+    memo_scope(memo_scope const &) = delete;
+    memo_scope & operator=(memo_scope const &) = delete;
+
+    ~memo_scope() {memo_table::current() = m_previous;}
+};
+
+/******************************************************************************************/
+
+}
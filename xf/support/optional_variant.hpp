@@ -15,7 +15,7 @@ template <class ...Types> using recursive_optional_variant = optional_variant<tr
 template <class ...Types> using nonrecursive_optional_variant = optional_variant<false, Types...>;
 
 template <bool B=false> static constexpr auto optional_variant_c = hana::fuse(hana::template_<recursive_optional_variant>);
-template <> static constexpr auto optional_variant_c<> = hana::fuse(hana::template_<nonrecursive_optional_variant>);
+template <> constexpr auto optional_variant_c<> = hana::fuse(hana::template_<nonrecursive_optional_variant>);
 
 /******************************************************************************************/
 
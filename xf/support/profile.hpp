@@ -0,0 +1,220 @@
+#pragma once
+#include "common.hpp"
+#include "counter.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <ostream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Calls, successes, backtracking and time of each rule and alternative branch checked in a parse
+// Each distinct stack of them is kept apart, so the time can be drawn as a flame graph
+class profiler {
+    struct node {
+        std::size_t parent;
+        std::string name;
+        std::size_t calls = 0, successes = 0, backtracked = 0;
+        std::uint64_t cycles = 0;
+    };
+
+    struct frame {
+        std::size_t node;
+        std::uint64_t start;
+        std::ptrdiff_t begin, reach;
+    };
+
+    std::vector<node> m_nodes{node{0, std::string()}};
+    std::map<std::tuple<std::size_t, void const *, std::size_t>, std::size_t> m_children;
+    std::vector<frame> m_stack;
+
+    std::size_t child(void const *id, std::size_t index, char const *name) {
+        auto const parent = m_stack.empty() ? 0 : m_stack.back().node;
+        auto it = m_children.emplace(std::make_tuple(parent, id, index), m_nodes.size());
+        if (it.second) {
+            // Branches are named after what they are a branch of, as "rule|0"
+            auto label = name ? std::string(name) : m_nodes[parent].name + '|' + std::to_string(index);
+            m_nodes.push_back(node{parent, std::move(label)});
+        }
+        return it.first->second;
+    }
+
+    // Cycles of each node less those of its children; children always come after their parent
+    std::vector<std::uint64_t> selves() const {
+        std::vector<std::uint64_t> s(m_nodes.size());
+        for (std::size_t i = 0; i != m_nodes.size(); ++i) s[i] = m_nodes[i].cycles;
+        for (std::size_t i = 1; i != m_nodes.size(); ++i) s[m_nodes[i].parent] -= std::min(s[m_nodes[i].parent], m_nodes[i].cycles);
+        return s;
+    }
+
+    bool below_same_name(std::size_t n) const {
+        for (auto p = m_nodes[n].parent; p != 0; p = m_nodes[p].parent) if (m_nodes[p].name == m_nodes[n].name) return true;
+        return false;
+    }
+
+public:
+
+    struct entry {
+        std::string name;
+        std::size_t calls = 0, successes = 0, backtracked = 0;
+        std::uint64_t cycles = 0, self = 0;
+    };
+
+    // Time stamp counter where there is one, otherwise nanoseconds
+    static std::uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+    }
+
+    // A rule is named and has index 0; a branch has no name and is identified by its alternative and index
+    // Offsets are from the start of the input, or all 0 where that is not known
+    void enter(void const *id, std::size_t index, char const *name, std::ptrdiff_t offset) {
+        m_stack.push_back(frame{child(id, index, name), 0, offset, offset});
+        m_stack.back().start = ticks();
+    }
+
+    // What was reached but not kept by a failure counts as backtracked, however deep it was reached
+    void exit(bool success, std::ptrdiff_t offset) {
+        auto const end = ticks();
+        auto const f = m_stack.back();
+        m_stack.pop_back();
+        auto &n = m_nodes[f.node];
+        ++n.calls;
+        n.cycles += end - f.start;
+        auto reach = f.reach;
+        if (success) {
+            ++n.successes;
+            reach = std::max(reach, offset);
+        } else n.backtracked += static_cast<std::size_t>(std::max<std::ptrdiff_t>(reach - f.begin, 0));
+        if (!m_stack.empty()) m_stack.back().reach = std::max(m_stack.back().reach, reach);
+    }
+
+    void clear() {m_nodes.resize(1); m_children.clear(); m_stack.clear();}
+
+    // Totals for each name, most self time first; cycles of a name inside itself are only counted once
+    std::vector<entry> flat() const {
+        std::map<std::string, entry> totals;
+        auto const s = selves();
+        for (std::size_t i = 1; i != m_nodes.size(); ++i) {
+            auto const &n = m_nodes[i];
+            auto &e = totals[n.name];
+            e.name = n.name;
+            e.calls += n.calls;
+            e.successes += n.successes;
+            e.backtracked += n.backtracked;
+            e.self += s[i];
+            if (!below_same_name(i)) e.cycles += n.cycles;
+        }
+        std::vector<entry> out;
+        for (auto &t : totals) out.push_back(std::move(t.second));
+        std::stable_sort(out.begin(), out.end(), [](auto const &a, auto const &b) {return a.self > b.self;});
+        return out;
+    }
+
+    void print_flat(std::ostream &os) const {
+        os << "calls\tsuccesses\tbacktracked\tcycles\tself\tname\n";
+        for (auto const &e : flat())
+            os << e.calls << '\t' << e.successes << '\t' << e.backtracked << '\t' << e.cycles << '\t' << e.self << '\t' << e.name << '\n';
+    }
+
+    // One "outer;inner self-cycles" line per stack, the input to flamegraph.pl
+    void print_collapsed(std::ostream &os) const {
+        auto const s = selves();
+        for (std::size_t i = 1; i != m_nodes.size(); ++i) {
+            std::vector<std::size_t> path;
+            for (auto p = i; p != 0; p = m_nodes[p].parent) path.push_back(p);
+            for (auto p = path.rbegin(); p != path.rend(); ++p) os << (p == path.rbegin() ? "" : ";") << m_nodes[*p].name;
+            os << ' ' << s[i] << '\n';
+        }
+    }
+
+    // Profiler used by profiled checks on this thread, if any
+    static profiler *& current() {
+        static thread_local profiler *p = nullptr;
+        return p;
+    }
+};
+
+/******************************************************************************************/
+
+// Make a profiler current for the lifetime of the scope, measuring offsets from the given start of input
+template <class Iterator>
+class profile_scope {
+    profiler *m_previous;
+    Iterator const *m_previous_origin;
+
+public:
+
+    static Iterator const *& origin() {
+        static thread_local Iterator const *o = nullptr;
+        return o;
+    }
+
+    profile_scope(profiler *p, Iterator const &o) : m_previous(profiler::current()), m_previous_origin(origin()) {
+        profiler::current() = p;
+        origin() = &o;
+    }
+
+    profile_scope(profile_scope const &) = delete;
+    profile_scope & operator=(profile_scope const &) = delete;
+
+    ~profile_scope() {profiler::current() = m_previous; origin() = m_previous_origin;}
+};
+
+/******************************************************************************************/
+
+namespace detail {
+
+template <class Iterator, int_if<std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value> = 0>
+std::ptrdiff_t profile_offset(Iterator const &i, int) {
+    auto const o = profile_scope<Iterator>::origin();
+    return o ? i - *o : 0;
+}
+
+template <class Iterator>
+std::ptrdiff_t profile_offset(Iterator const &, long) {return 0;}
+
+}
+
+// Run a check, recording it in the current profiler if the tag asks for it
+template <class Tag, class Window, class Check, class Valid, int_if<!is_profile<Tag>> = 0>
+auto profiled(Tag, void const *, std::size_t, char const *, Window &, Check &&check, Valid &&) {return check();}
+
+template <class Tag, class Window, class Check, class Valid, int_if<is_profile<Tag>> = 0>
+auto profiled(Tag, void const *id, std::size_t index, char const *name, Window &w, Check &&check, Valid &&valid) {
+    auto p = profiler::current();
+    if (!p) return check();
+    // A check which throws still leaves the stack as it found it
+    struct guard {
+        profiler *p;
+        bool open = true;
+        ~guard() {if (open) p->exit(false, 0);}
+    } g{p};
+    p->enter(id, index, name, detail::profile_offset(w.begin(), 0));
+    auto data = check();
+    g.open = false;
+    p->exit(bool(valid(data)), detail::profile_offset(w.begin(), 0));
+    return data;
+}
+
+/******************************************************************************************/
+
+}
@@ -1,16 +1,28 @@
 #pragma once
 #include <boost/checked_delete.hpp>
 #include <boost/variant/recursive_wrapper.hpp>
+#include "arena.hpp"
+#include <memory>
 
 namespace xf {
 
 /******************************************************************************************/
 
+// Allocated from the current arena when there is one, otherwise from the heap
 template <class Type>
 class recursive_wrap {
-    struct deleter {void operator()(Type *t) const {boost::checked_delete(t);}};
+    struct deleter {
+        bool owned;
+        void operator()(Type *t) const {if (owned) boost::checked_delete(t); else t->~Type();}
+    };
     std::unique_ptr<Type, deleter> ptr;
 
+    template <class ...Ts>
+    static std::unique_ptr<Type, deleter> make(arena *a, Ts &&...ts) {
+        if (a) return {new(a->allocate(sizeof(Type), alignof(Type))) Type{std::forward<Ts>(ts)...}, deleter{false}};
+        return {new Type{std::forward<Ts>(ts)...}, deleter{true}};
+    }
+
 public:
     using value_type = Type;
 
@@ -18,13 +30,16 @@ public:
     auto const & value() const {return ptr->value();}
 
     template <class ...Ts>
-    explicit recursive_wrap(Ts &&...ts) : ptr(new Type{std::forward<Ts>(ts)...}) {}
+    explicit recursive_wrap(Ts &&...ts) : ptr(make(arena::current(), std::forward<Ts>(ts)...)) {}
 
     template <class T> explicit operator T() const & {return *ptr;}
     template <class T> explicit operator T() && {return std::move(*ptr);}
     template <class T> explicit operator T() & {return *ptr;}
 
-    recursive_wrap(recursive_wrap const &other) : ptr(new Type{other.value()}) {}
+    // A copy of something on the heap, like a parsed attribute, stays on the heap
+    recursive_wrap(recursive_wrap const &other)
+        : ptr(make(other.ptr.get_deleter().owned ? nullptr : arena::current(), other.value())) {}
+    recursive_wrap(recursive_wrap &other) : recursive_wrap(static_cast<recursive_wrap const &>(other)) {}
     recursive_wrap(recursive_wrap &&) = default;
 
     recursive_wrap & operator=(recursive_wrap w) {swap(w); return *this;}
@@ -0,0 +1,228 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace xf {
+
+/******************************************************************************************/
+
+inline unsigned lowest_bit(std::uint64_t m) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(m);
+#else
+    unsigned i = 0;
+    for (; !(m & 1); m >>= 1) ++i;
+    return i;
+#endif
+}
+
+inline unsigned highest_bit(std::uint64_t m) {
+#if defined(__GNUC__)
+    return 63 - __builtin_clzll(m);
+#else
+    unsigned i = 0;
+    while (m >>= 1) ++i;
+    return i;
+#endif
+}
+
+/******************************************************************************************/
+
+namespace detail {
+
+// Byte classes for the scanners below: a scalar test plus SSE2/AVX2 versions giving 0xFF per matching byte
+struct byte_equal {
+    char c;
+    bool operator()(char x) const {return x == c;}
+#if defined(__SSE2__)
+    __m128i operator()(__m128i x) const {return _mm_cmpeq_epi8(x, _mm_set1_epi8(c));}
+#endif
+#if defined(__AVX2__)
+    __m256i operator()(__m256i x) const {return _mm256_cmpeq_epi8(x, _mm256_set1_epi8(c));}
+#endif
+};
+
+// ' ' and '\t'
+struct byte_blank {
+    bool operator()(char x) const {return x == ' ' || x == '\t';}
+#if defined(__SSE2__)
+    __m128i operator()(__m128i x) const {
+        return _mm_or_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(x, _mm_set1_epi8('\t')));
+    }
+#endif
+#if defined(__AVX2__)
+    __m256i operator()(__m256i x) const {
+        return _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(x, _mm256_set1_epi8('\t')));
+    }
+#endif
+};
+
+// ' ' and '\t' through '\r', as std::isspace in the "C" locale
+struct byte_space {
+    bool operator()(char x) const {return x == ' ' || static_cast<unsigned char>(x - '\t') <= '\r' - '\t';}
+#if defined(__SSE2__)
+    __m128i operator()(__m128i x) const {
+        auto const t = _mm_sub_epi8(x, _mm_set1_epi8('\t'));
+        auto const control = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8('\r' - '\t')), t);
+        return _mm_or_si128(control, _mm_cmpeq_epi8(x, _mm_set1_epi8(' ')));
+    }
+#endif
+#if defined(__AVX2__)
+    __m256i operator()(__m256i x) const {
+        auto const t = _mm256_sub_epi8(x, _mm256_set1_epi8('\t'));
+        auto const control = _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8('\r' - '\t')), t);
+        return _mm256_or_si256(control, _mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')));
+    }
+#endif
+};
+
+// Any 256-bit set of bytes, laid out for a nibble lookup: bit r of low[c] (or high[c] for r >= 8) is byte 16r + c
+class byte_table {
+    unsigned char m_low[16], m_high[16];
+
+public:
+
+    constexpr byte_table() : m_low{}, m_high{} {}
+
+    constexpr byte_table & insert(unsigned char x) {
+        (x < 0x80 ? m_low : m_high)[x & 0xF] |= static_cast<unsigned char>(1u << ((x >> 4) & 7));
+        return *this;
+    }
+
+    constexpr byte_table & insert(unsigned char lo, unsigned char hi) {
+        for (unsigned c = lo; c <= hi; ++c) insert(static_cast<unsigned char>(c));
+        return *this;
+    }
+
+    constexpr bool contains(unsigned char x) const {return ((x < 0x80 ? m_low : m_high)[x & 0xF] >> ((x >> 4) & 7)) & 1;}
+
+    bool operator()(char x) const {return contains(static_cast<unsigned char>(x));}
+
+#if defined(__SSSE3__)
+    __m128i operator()(__m128i x) const {
+        auto const column = _mm_and_si128(x, _mm_set1_epi8(0xF));
+        auto const row = _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0xF));
+        auto const low = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_low)), column);
+        auto const high = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_high)), column);
+        auto const upper = _mm_cmpgt_epi8(row, _mm_set1_epi8(7));
+        auto const bits = _mm_or_si128(_mm_and_si128(upper, high), _mm_andnot_si128(upper, low));
+        auto const bit = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), row);
+        return _mm_cmpeq_epi8(_mm_and_si128(bits, bit), bit);
+    }
+#endif
+#if defined(__AVX2__)
+    __m256i operator()(__m256i x) const {
+        auto const column = _mm256_and_si256(x, _mm256_set1_epi8(0xF));
+        auto const row = _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0xF));
+        auto const low = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_low))), column);
+        auto const high = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<__m128i const *>(m_high))), column);
+        auto const upper = _mm256_cmpgt_epi8(row, _mm256_set1_epi8(7));
+        auto const bits = _mm256_or_si256(_mm256_and_si256(upper, high), _mm256_andnot_si256(upper, low));
+        auto const bit = _mm256_shuffle_epi8(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+                                                              1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128), row);
+        return _mm256_cmpeq_epi8(_mm256_and_si256(bits, bit), bit);
+    }
+#endif
+};
+
+#if defined(__SSE2__)
+template <class Class>
+auto skip_vectors(char const *b, char const *e, Class const &in, int) -> decltype(in(std::declval<__m128i>()), static_cast<char const *>(b)) {
+#if defined(__AVX2__)
+    for (; e - b >= 32; b += 32) {
+        auto const m = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(in(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(b)))));
+        if (m) return b + lowest_bit(m);
+    }
+#endif
+    for (; e - b >= 16; b += 16) {
+        auto const m = ~static_cast<std::uint32_t>(_mm_movemask_epi8(in(_mm_loadu_si128(reinterpret_cast<__m128i const *>(b))))) & 0xFFFF;
+        if (m) return b + lowest_bit(m);
+    }
+    return b;
+}
+#endif
+
+// Classes without a vector test go a byte at a time
+template <class Class>
+char const * skip_vectors(char const *b, char const *, Class const &, long) {return b;}
+
+// First position in [b, e) whose byte is not in the class
+template <class Class>
+char const * skip_class(char const *b, char const *e, Class const &in) {
+    b = skip_vectors(b, e, in, 0);
+    while (b != e && in(*b)) ++b;
+    return b;
+}
+
+}
+
+/******************************************************************************************/
+
+inline char const * skip_byte(char const *b, char const *e, char c) {return detail::skip_class(b, e, detail::byte_equal{c});}
+inline char const * skip_blank(char const *b, char const *e) {return detail::skip_class(b, e, detail::byte_blank());}
+inline char const * skip_space(char const *b, char const *e) {return detail::skip_class(b, e, detail::byte_space());}
+inline char const * skip_table(char const *b, char const *e, detail::byte_table const &t) {return detail::skip_class(b, e, t);}
+
+/******************************************************************************************/
+
+constexpr char ascii_lower(char c) {return c >= 'A' && c <= 'Z' ? static_cast<char>(c | 0x20) : c;}
+
+namespace detail {
+
+#if defined(__SSE2__)
+inline __m128i ascii_lower(__m128i x) {
+    auto const t = _mm_sub_epi8(x, _mm_set1_epi8('A'));
+    auto const upper = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8('Z' - 'A')), t);
+    return _mm_or_si128(x, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+#endif
+
+}
+
+// Whether n bytes at in match a literal given as lower, its ASCII lowercase, and fold, 0x20 where it has a letter
+// in | fold == lower takes either case of a letter and only the byte itself otherwise
+// All three must be readable up to n rounded up to a multiple of 32; what lies past n is ignored
+inline bool folded_equal(char const *in, char const *lower, char const *fold, std::size_t n) {
+#if defined(__AVX2__)
+    for (std::size_t i = 0; i < n; i += 32) {
+        auto const x = _mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const *>(in + i)), _mm256_loadu_si256(reinterpret_cast<__m256i const *>(fold + i)));
+        auto m = ~static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lower + i)))));
+        if (n - i < 32) m &= (std::uint32_t(1) << (n - i)) - 1;
+        if (m) return false;
+    }
+#elif defined(__SSE2__)
+    for (std::size_t i = 0; i < n; i += 16) {
+        auto const x = _mm_or_si128(_mm_loadu_si128(reinterpret_cast<__m128i const *>(in + i)), _mm_loadu_si128(reinterpret_cast<__m128i const *>(fold + i)));
+        auto m = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_loadu_si128(reinterpret_cast<__m128i const *>(lower + i))))) & 0xFFFF;
+        if (n - i < 16) m &= (std::uint32_t(1) << (n - i)) - 1;
+        if (m) return false;
+    }
+#else
+    for (std::size_t i = 0; i != n; ++i) if ((in[i] | fold[i]) != lower[i]) return false;
+#endif
+    return true;
+}
+
+// Length of the leading stretch of a and b which is equal ignoring ASCII case and has no byte above 0x7F
+inline std::size_t ascii_caseless_prefix(char const *a, char const *b, std::size_t n) {
+    std::size_t i = 0;
+#if defined(__SSE2__)
+    for (; n - i >= 16; i += 16) {
+        auto const x = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i)), y = _mm_loadu_si128(reinterpret_cast<__m128i const *>(b + i));
+        auto const same = _mm_movemask_epi8(_mm_cmpeq_epi8(detail::ascii_lower(x), detail::ascii_lower(y)));
+        auto const m = (~static_cast<std::uint32_t>(same) | static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_or_si128(x, y)))) & 0xFFFF;
+        if (m) return i + lowest_bit(m);
+    }
+#endif
+    for (; i != n && !((a[i] | b[i]) & 0x80) && ascii_lower(a[i]) == ascii_lower(b[i]); ++i) {}
+    return i;
+}
+
+/******************************************************************************************/
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "arena.hpp"
+#include "memo.hpp"
+
+#include <cstddef>
+
+namespace xf {
+
+/******************************************************************************************/
+
+// Storage kept from one parse to the next: the check arena, which also holds check data containers
+// and recursive nodes, and the memo table. Parsing many small inputs then costs no heap traffic
+// beyond the attributes once the arena has grown to fit the largest of them
+class session {
+    arena m_arena;
+    memo_table m_memo;
+    std::size_t m_initial_size, m_parses = 0, m_blocks = 0, m_fresh_blocks = 0;
+
+public:
+
+    explicit session(std::size_t initial_size=4096, std::size_t max_memo_entries=1 << 16)
+        : m_arena(initial_size), m_memo(max_memo_entries), m_initial_size(initial_size) {}
+
+    session(session const &) = delete;
+    session & operator=(session const &) = delete;
+
+    arena & memory() {return m_arena;}
+    memo_table & memo() {return m_memo;}
+
+    // Called around each parse, so the counts below can be kept. Memo entries hold check data in
+    // the arena, so they go before it is reset
+    void begin() {
+        m_memo.clear();
+        m_arena.reset();
+        m_blocks -= m_arena.blocks();
+    }
+
+    void end() {
+        ++m_parses;
+        m_blocks += m_arena.blocks();
+        m_fresh_blocks += arena::blocks_for(m_arena.used(), m_initial_size);
+    }
+
+    std::size_t parses() const {return m_parses;}
+
+    // Heap allocations for the arena that parsing each input afresh would have made, less those made
+    std::size_t allocations_saved() const {return m_fresh_blocks > m_blocks ? m_fresh_blocks - m_blocks : 0;}
+
+    double allocations_saved_per_parse() const {return m_parses ? double(allocations_saved()) / m_parses : 0.0;}
+};
+
+/******************************************************************************************/
+
+}
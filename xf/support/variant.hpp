@@ -5,6 +5,10 @@
 #include <boost/hana/equal.hpp>
 #include <boost/hana/not_equal.hpp>
 #include <boost/hana/greater_equal.hpp>
+#include <boost/hana/plus.hpp>
+
+#include <cassert>
+#include <utility>
 
 namespace xf {
 
@@ -28,6 +32,11 @@ std::string const variant_error<Index>::msg = "variant error with index " + std:
 
 /******************************************************************************************/
 
+// Variants with more alternatives than this dispatch through a jump table instead of an if-chain
+static constexpr std::size_t linear_dispatch_limit = 4;
+
+/******************************************************************************************/
+
 template <class V, class P>
 constexpr auto index_if(V const &v, P &&p) {
     constexpr auto first = hana::reverse_partial(hana::at, 0_c);
@@ -48,6 +57,8 @@ struct variant {
 
     static constexpr auto can_move = hana::all_of(types, traits::is_move_constructible);
     static constexpr auto can_copy = hana::all_of(types, traits::is_copy_constructible);
+    // lets containers of variants move rather than copy them when they grow
+    static constexpr auto nothrow_move = hana::all_of(types, traits::is_nothrow_move_constructible);
     static constexpr auto can_swap = can_move;//hana::all_of(types, traits::is_swappable);
 
     template <class I, class ...Ts, int_if<I::value >= 0> = 0>
@@ -80,14 +91,18 @@ struct variant {
     struct move {
         template <class I>
         void operator()(I i, variant &self, variant &other) const {
-            new(self.ptr()) decltype(*types[i]){std::move(other[i])};
+            // moving the wrapper itself lets a recursive_wrap hand over its pointer
+            using T = decltype(*types[i]);
+            new(self.ptr()) T(std::move(*static_cast<T *>(other.ptr())));
         }
     };
 
     struct copy {
         template <class I>
         void operator()(I i, variant &self, variant const &other) const {
-            new(self.ptr()) decltype(*types[i]){other[i]};
+            // as with move, so a recursive_wrap can tell where its copy belongs
+            using T = decltype(*types[i]);
+            new(self.ptr()) T(*static_cast<T const *>(other.ptr()));
         }
     };
 
@@ -119,7 +134,7 @@ struct variant {
 
 protected:
 
-    // can redo to use jump table
+    // Linear dispatch: compares the runtime index against each alternative in turn
     template <class F, class I, class N, class ...Ts, int_if<I::value + 1 >= size> = 0>
     static decltype(auto) fold(I i, N n, F &&f, Ts &&...ts) {
         static_assert(i >= 0_c && i < size, "variant out of range");
@@ -133,6 +148,30 @@ protected:
         else return fold(i + 1_c, n, std::forward<F>(f), std::forward<Ts>(ts)...);
     }
 
+    // Jump table: one thunk per alternative, indexed directly by the runtime index
+    template <long long I, class R, class F, class ...Ts>
+    static R jump_one(F &&f, Ts &&...ts) {return std::forward<F>(f)(hana::llong_c<I>, std::forward<Ts>(ts)...);}
+
+    template <class F, class N, class ...Ts, std::size_t ...Is>
+    static decltype(auto) jump(std::index_sequence<Is...>, N n, F &&f, Ts &&...ts) {
+        using R = decltype(std::forward<F>(f)(0_c, std::forward<Ts>(ts)...));
+        static constexpr R (*table[])(F &&, Ts &&...) = {&jump_one<Is, R, F, Ts...>...};
+        assert(0 <= int(n) && int(n) < int(sizeof...(Types)));
+        return table[n](std::forward<F>(f), std::forward<Ts>(ts)...);
+    }
+
+    // Narrow variants keep the inlinable if-chain
+    template <bool B=true, class F, class N, class ...Ts, int_if<B && (sizeof...(Types) <= linear_dispatch_limit)> = 0>
+    static decltype(auto) dispatch(N n, F &&f, Ts &&...ts) {
+        return fold(0_c, n, std::forward<F>(f), std::forward<Ts>(ts)...);
+    }
+
+    // Wide variants use the jump table: one indirect call regardless of the number of alternatives
+    template <bool B=true, class F, class N, class ...Ts, int_if<B && (sizeof...(Types) > linear_dispatch_limit)> = 0>
+    static decltype(auto) dispatch(N n, F &&f, Ts &&...ts) {
+        return jump(std::make_index_sequence<sizeof...(Types)>(), n, std::forward<F>(f), std::forward<Ts>(ts)...);
+    }
+
 public:
 
     constexpr auto index() const {return status;}
@@ -145,9 +184,9 @@ public:
 
     /**************************************************************************************/
 
-    variant(variant &&v, int_if<can_move> = 0) : status(v.status) {fold(0_c, status, move(), *this, v);}
+    variant(variant &&v, int_if<can_move> = 0) noexcept(nothrow_move) : status(v.status) {dispatch(status, move(), *this, v);}
 
-    variant(variant const &v, int_if<can_copy> = 0) : status(v.status) {fold(0_c, status, copy(), *this, v);}
+    variant(variant const &v, int_if<can_copy> = 0) : status(v.status) {dispatch(status, copy(), *this, v);}
 
     friend void swap(variant &v1, variant &v2) {std::swap(v1.data, v2.data); std::swap(v1.status, v2.status);}
 
@@ -171,7 +210,7 @@ public:
 
     template <class I, class ...Ts>
     void emplace(I i, Ts &&...ts) {
-        fold(0_c, status, destroy(), *this);
+        dispatch(status, destroy(), *this);
         status = i;
         new(ptr()) decltype(*types[i]){std::forward<Ts>(ts)...};
     }
@@ -179,35 +218,35 @@ public:
     /**************************************************************************************/
 
     template <class ...Ts>
-    decltype(auto) visit(Ts &&...ts) {return fold(0_c, status, at(), *this, std::forward<Ts>(ts)...);}
+    decltype(auto) visit(Ts &&...ts) {return dispatch(status, at(), *this, std::forward<Ts>(ts)...);}
 
     template <class F, class ...Ts>
-    decltype(auto) visit(Ts &&...ts) const {return fold(0_c, status, at(), *this, std::forward<Ts>(ts)...);}
+    decltype(auto) visit(Ts &&...ts) const {return dispatch(status, at(), *this, std::forward<Ts>(ts)...);}
 
     template <class ...Ts>
-    decltype(auto) operator()(Ts &&...ts) const {return fold(0_c, status, call(), *this, std::forward<Ts>(ts)...);}
+    decltype(auto) operator()(Ts &&...ts) const {return dispatch(status, call(), *this, std::forward<Ts>(ts)...);}
 
     /**************************************************************************************/
 
     template <class T, int_if<decltype(can_convert_const<T>())::value> = 0>
-    explicit operator T() const & {return fold(0_c, status, convert(), *this, hana::type_c<T>);}
+    explicit operator T() const & {return dispatch(status, convert(), *this, hana::type_c<T>);}
 
     template <class T, int_if<decltype(can_convert_lvalue<T>())::value> = 0>
-    explicit operator T() & {return fold(0_c, status, convert(), *this, hana::type_c<T>);}
+    explicit operator T() & {return dispatch(status, convert(), *this, hana::type_c<T>);}
 
     template <class T, int_if<decltype(can_convert_rvalue<T>())::value> = 0>
-    explicit operator T() && {return fold(0_c, status, convert(), static_cast<variant &&>(*this), hana::type_c<T>);}
+    explicit operator T() && {return dispatch(status, convert(), static_cast<variant &&>(*this), hana::type_c<T>);}
 
     /**************************************************************************************/
 
-    ~variant() {fold(0_c, status, destroy(), *this);}
+    ~variant() {dispatch(status, destroy(), *this);}
 };
 
 template <class ...Types> using recursive_variant = variant<true, Types...>;
 template <class ...Types> using nonrecursive_variant = variant<false, Types...>;
 
 template <bool B=false> static constexpr auto variant_c = hana::fuse(hana::template_<recursive_variant>);
-template <> static constexpr auto variant_c<> = hana::fuse(hana::template_<nonrecursive_variant>);
+template <> constexpr auto variant_c<> = hana::fuse(hana::template_<nonrecursive_variant>);
 
 
 }